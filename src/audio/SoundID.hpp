@@ -0,0 +1,28 @@
+// ================================================================================================
+// File: SoundID.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 27, 2025
+// Description: Defines the SoundID enum, which names every sound effect in the game. It is kept
+//              apart from the SoundManager so the simulation can name sounds without the audio
+//              library.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+enum class SoundID
+{
+	BULLET_SHOOT,
+	SPLASH_SHOOT,
+	SPLASH_EXPLODE,
+	SLOW_PULSE,
+	LIFE_LOST,
+	NEW_WAVE,
+	ENEMY_HIT,
+	ENEMY_DEATH,
+	TOWER_UPGRADE,
+	BUTTON_CLICK,
+	Count
+};
@@ -7,62 +7,123 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <algorithm>
 #include <iostream>
 #include "SoundManager.hpp"
 #include "../core/Utility.hpp"
 
 using namespace Utility;
 
-void SoundManager::loadSounds()
+const int SoundManager::VOICE_COUNT = 32;
+
+void SoundManager::setSounds(std::unordered_map<SoundID, std::shared_ptr<sf::SoundBuffer>> buffers)
+{
+	soundBuffers = std::move(buffers);
+	if (soundBuffers.empty())
+		return;
+
+	// An sf::Sound needs a buffer to be created with; each voice gets its real one when it is played
+	voices.resize(VOICE_COUNT);
+	for (Voice& voice : voices)
+		voice.sound.emplace(*soundBuffers.begin()->second);
+}
+
+void SoundManager::queueSound(SoundID soundID, float pitchVariancePercentage, float volumeMultiplier)
+{
+	// Sounds are never loaded when the simulation runs headless, so there is nothing to play
+	if (soundBuffers.empty())
+		return;
+
+	if (pitchVariancePercentage < 0.f || pitchVariancePercentage > 1.f) {
+		std::cerr << "Warning: Pitch variance percentage must be between 0 and 1! Pitch variance set to default (0%)" << std::endl;
+		pitchVariancePercentage = 0.f;
+	}
+
+	// The same sound queued several times in one frame is only played once, as loud as the loudest
+	QueuedSound& queuedSound = queuedSounds[static_cast<size_t>(soundID)];
+	queuedSound.isQueued = true;
+	queuedSound.pitchVariancePercentage = std::max(queuedSound.pitchVariancePercentage, pitchVariancePercentage);
+	queuedSound.volumeMultiplier = std::max(queuedSound.volumeMultiplier, volumeMultiplier);
+}
+
+void SoundManager::playQueuedSounds()
 {
-	auto load = [&](SoundID soundID, const std::string& filename)
+	for (size_t id = 0; id < queuedSounds.size(); ++id)
+	{
+		if (queuedSounds[id].isQueued)
 		{
-			soundBuffers[soundID] = std::make_shared<sf::SoundBuffer>(filename);
-		};
-
-	load(SoundID::BULLET_SHOOT, "assets/sounds/bullet-shoot.wav");
-	load(SoundID::SPLASH_SHOOT, "assets/sounds/splash-shoot.wav");
-	load(SoundID::SPLASH_EXPLODE, "assets/sounds/splash-explosion.wav");
-	load(SoundID::SLOW_PULSE, "assets/sounds/slow-pulse.wav");
-	load(SoundID::LIFE_LOST, "assets/sounds/life-lost.wav");
-	load(SoundID::NEW_WAVE, "assets/sounds/new-wave.wav");
-	load(SoundID::ENEMY_HIT, "assets/sounds/enemy-hit.wav");
-	load(SoundID::ENEMY_DEATH, "assets/sounds/enemy-death.wav");
-	load(SoundID::TOWER_UPGRADE, "assets/sounds/tower-upgrade.wav");
-	load(SoundID::BUTTON_CLICK, "assets/sounds/button-click.wav");
+			play(static_cast<SoundID>(id), queuedSounds[id]);
+			queuedSounds[id] = QueuedSound();
+		}
+	}
+	frame++;
 }
 
-void SoundManager::playSound(SoundID soundID, float pitchVariancePercentage, float volumeMultiplier)
+void SoundManager::play(SoundID soundID, const QueuedSound& queuedSound)
 {
 	auto it = soundBuffers.find(soundID);
-	if (it != soundBuffers.end())
+	if (it == soundBuffers.end())
 	{
-		auto sound = std::make_shared<sf::Sound>(*it->second);
+		std::cerr << "Error: Sound ID not found!" << std::endl;
+		return;
+	}
 
-		if (pitchVariancePercentage < 0.f || pitchVariancePercentage > 1.f) {
-			std::cerr << "Warning: Pitch variance percentage must be between 0 and 1! Pitch variance set to default (0%)" << std::endl;
-			pitchVariancePercentage = 0.f;
-		}
-		if (pitchVariancePercentage != 0.f)
-			sound->setPitch(Utility::randomPitch(pitchVariancePercentage));
+	Voice& voice = findVoice(soundID);
+	voice.soundID = soundID;
+	voice.startedAt = frame;
 
-		sound->setVolume(volume * volumeMultiplier);
-		sound->play();
+	sf::Sound& sound = *voice.sound;
+	sound.stop();
+	sound.setBuffer(*it->second);
+	sound.setPitch(queuedSound.pitchVariancePercentage != 0.f ? Utility::randomPitch(rng, queuedSound.pitchVariancePercentage) : 1.f);
+	sound.setVolume(volume * queuedSound.volumeMultiplier);
+	sound.play();
+}
 
-		activeSounds.push_back(sound);
-	}
-	else
+SoundManager::Voice& SoundManager::findVoice(SoundID soundID)
+{
+	Voice* oldestOfSameID = nullptr;
+	Voice* oldest = nullptr;
+	Voice* idle = nullptr;
+	int playingOfSameID = 0;
+
+	for (Voice& voice : voices)
 	{
-		std::cerr << "Error: Sound ID not found!" << std::endl;
+		if (voice.sound->getStatus() == sf::Sound::Status::Stopped)
+		{
+			if (!idle)
+				idle = &voice;
+			continue;
+		}
+
+		if (!oldest || voice.startedAt < oldest->startedAt)
+			oldest = &voice;
+
+		if (voice.soundID == soundID)
+		{
+			playingOfSameID++;
+			if (!oldestOfSameID || voice.startedAt < oldestOfSameID->startedAt)
+				oldestOfSameID = &voice;
+		}
 	}
+
+	if (playingOfSameID >= getMaxVoices(soundID))
+		return *oldestOfSameID;
+	if (idle)
+		return *idle;
+	return *oldest;
 }
 
-void SoundManager::cleanupSounds()
+int SoundManager::getMaxVoices(SoundID soundID)
 {
-	activeSounds.erase(
-		std::remove_if(activeSounds.begin(), activeSounds.end(),
-			[](const std::shared_ptr<sf::Sound>& sound) {
-				return sound->getStatus() == sf::Sound::Status::Stopped;
-			}),
-		activeSounds.end());
+	switch (soundID)
+	{
+	case SoundID::BULLET_SHOOT:   return 6;
+	case SoundID::SPLASH_SHOOT:   return 4;
+	case SoundID::SPLASH_EXPLODE: return 4;
+	case SoundID::SLOW_PULSE:     return 3;
+	case SoundID::ENEMY_HIT:      return 6;
+	case SoundID::ENEMY_DEATH:    return 6;
+	default:                      return 2;
+	}
 }
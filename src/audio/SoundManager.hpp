@@ -3,6 +3,10 @@
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: May 6, 2025
 // Description: Defines the SoundManager class, which is responsible for managing sound effects in the game.
+//              The game queues the simulation's sound events; they are played once per frame from a
+//              fixed pool of voices. Events with the same ID queued in one frame are merged into one,
+//              and each ID has a cap on how many voices it may use at once, past which its oldest
+//              voice is restarted. Nothing is allocated while playing.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -10,38 +14,62 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 #include <SFML/Audio.hpp>
+#include "SoundID.hpp"
+#include "../core/Rng.hpp"
 
 class SoundManager
 {
 public:
-	enum class SoundID
-	{
-		BULLET_SHOOT,
-		SPLASH_SHOOT,
-		SPLASH_EXPLODE,
-		SLOW_PULSE,
-		LIFE_LOST,
-		NEW_WAVE,
-		ENEMY_HIT,
-		ENEMY_DEATH,
-		TOWER_UPGRADE,
-		BUTTON_CLICK
-	};
+	using SoundID = ::SoundID;
 
-	void loadSounds();
+	// Takes over the decoded sounds (see AssetLoader) and creates the voices to play them on
+	void setSounds(std::unordered_map<SoundID, std::shared_ptr<sf::SoundBuffer>> buffers);
 
-	// Remove any sounds that are no longer playing
-	void cleanupSounds();
-
-	// Play a sound at specified volume with a random pitch variation.
+	// Queue a sound to be played at specified volume with a random pitch variation on the next
+	// call to playQueuedSounds(). Does nothing until setSounds() is called (e.g. headless simulation,
+	// or while the sounds are still loading).
 	// Note: pitchVariancePercentage 0.15f == +/- 15% variation
-	void playSound(SoundID soundID, float pitchVariancePercentage = 0.f, float volumeMultiplier = 1.f);
+	void queueSound(SoundID soundID, float pitchVariancePercentage = 0.f, float volumeMultiplier = 1.f);
+
+	// Plays the sounds queued since the last call. Called once per frame.
+	void playQueuedSounds();
 
 	float volume = 100.f;
 
+	static const int VOICE_COUNT;
+
 private:
+	struct QueuedSound
+	{
+		bool isQueued = false;
+		float pitchVariancePercentage = 0.f;
+		float volumeMultiplier = 0.f;
+	};
+
+	struct Voice
+	{
+		std::optional<sf::Sound> sound; // Created once the sound buffers are loaded
+		SoundID soundID = SoundID::Count;
+		std::uint64_t startedAt = 0;    // Frame the voice was last started on, to find the oldest
+	};
+
+	void play(SoundID soundID, const QueuedSound& queuedSound);
+	// Returns the voice to play a new sound of the given ID on, stealing the oldest one if needed
+	Voice& findVoice(SoundID soundID);
+	static int getMaxVoices(SoundID soundID);
+
 	std::unordered_map<SoundID, std::shared_ptr<sf::SoundBuffer>> soundBuffers;
-	std::vector<std::shared_ptr<sf::Sound>> activeSounds;
-};
\ No newline at end of file
+	std::array<QueuedSound, static_cast<size_t>(SoundID::Count)> queuedSounds;
+	std::vector<Voice> voices;
+	std::uint64_t frame = 0;
+
+	// Pitch variation is not part of the simulation, so it does not draw from the game's generator
+	Rng rng{ Rng::makeRandomSeed() };
+};
@@ -0,0 +1,212 @@
+// ================================================================================================
+// File: EnemyLayoutBenchmark.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 14, 2025
+// Description: Micro-benchmark comparing the structure-of-arrays EnemyPool against the previous
+//              array-of-structures layout, where every enemy carried its own shape, status effect
+//              vector and death effect vector. Both layouts run the same brute-force targeting scan
+//              (closest living enemy in range) and bullet collision scan at 1k and 10k enemies.
+//              Usage: EnemyLayoutBenchmark
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "../entities/EnemyPool.hpp"
+#include "../core/Grid.hpp"
+#include "../core/Utility.hpp"
+
+namespace
+{
+	// Mirrors the old per-enemy death particle, since replaced by the shared ParticleSystem
+	struct LegacyDeathEffect
+	{
+		float radius = 0.f;
+		sf::Color color;
+		sf::Vector2f positionCurrent, positionPrevious;
+		sf::Vector2f velocity;
+		float lifetime = 0.5f;
+		float timer = 0.f;
+	};
+
+	// Mirrors the memory layout of the old Enemy class (including its virtual Entity base)
+	class LegacyEnemy
+	{
+	public:
+		virtual ~LegacyEnemy() = default;
+
+		sf::Vector2f positionCurrent;
+		sf::Vector2f positionPrevious;
+		sf::CircleShape shape;
+		sf::Color defaultColor;
+		sf::Color currentColor;
+		float size = EnemyPool::SIZE;
+		std::vector<EnemyPool::StatusEffect> statusEffects;
+		float baseSpeed = 0.f;
+		float currentSpeed = 0.f;
+		float damageFlashTimer = 0.f;
+		float damageFlashDuration = 0.f;
+		sf::Color flashColor;
+		sf::Vector2i previousTile;
+		sf::Vector2f direction;
+		bool hasReachedEnd = false;
+		int health = 0;
+		int incomingDamage = 0;
+		int worth = 0;
+		std::vector<LegacyDeathEffect> deathEffects;
+		bool isRunningDeathEffect = false;
+	};
+
+	struct Query
+	{
+		sf::Vector2f origin;
+		float range;
+	};
+
+	const int QUERIES_PER_RUN = 512;
+	const int RUNS = 20;
+
+	int findClosestLegacy(const std::vector<LegacyEnemy>& enemies, const Query& query)
+	{
+		int closest = -1;
+		float closestDistanceSq = query.range * query.range;
+		for (int i = 0; i < static_cast<int>(enemies.size()); ++i)
+		{
+			const LegacyEnemy& enemy = enemies[i];
+			if (enemy.health - enemy.incomingDamage <= 0)
+				continue;
+			float distanceSq = Utility::distanceSquared(query.origin, enemy.positionCurrent);
+			if (distanceSq <= closestDistanceSq)
+			{
+				closestDistanceSq = distanceSq;
+				closest = i;
+			}
+		}
+		return closest;
+	}
+
+	int findClosestPool(const EnemyPool& enemies, const Query& query)
+	{
+		const float* positionsX = enemies.getPositionsX();
+		const float* positionsY = enemies.getPositionsY();
+
+		int closest = -1;
+		float closestDistanceSq = query.range * query.range;
+		for (int i = 0; i < enemies.size(); ++i)
+		{
+			if (enemies.getHealth(i) - enemies.getIncomingDamage(i) <= 0)
+				continue;
+			float dx = positionsX[i] - query.origin.x;
+			float dy = positionsY[i] - query.origin.y;
+			float distanceSq = dx * dx + dy * dy;
+			if (distanceSq <= closestDistanceSq)
+			{
+				closestDistanceSq = distanceSq;
+				closest = i;
+			}
+		}
+		return closest;
+	}
+
+	int countCollisionsLegacy(const std::vector<LegacyEnemy>& enemies, const Query& query)
+	{
+		int hits = 0;
+		for (const LegacyEnemy& enemy : enemies)
+			if (Utility::distanceSquared(query.origin, enemy.positionCurrent) <= enemy.size * enemy.size)
+				hits++;
+		return hits;
+	}
+
+	int countCollisionsPool(const EnemyPool& enemies, const Query& query)
+	{
+		const float* positionsX = enemies.getPositionsX();
+		const float* positionsY = enemies.getPositionsY();
+		const float sizeSq = EnemyPool::SIZE * EnemyPool::SIZE;
+
+		int hits = 0;
+		for (int i = 0; i < enemies.size(); ++i)
+		{
+			float dx = positionsX[i] - query.origin.x;
+			float dy = positionsY[i] - query.origin.y;
+			if (dx * dx + dy * dy <= sizeSq)
+				hits++;
+		}
+		return hits;
+	}
+
+	// Returns the average time per enemy visited in nanoseconds
+	template <typename Scan>
+	double measure(const std::vector<Query>& queries, int enemyCount, long long& checksum, Scan scan)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int run = 0; run < RUNS; ++run)
+			for (const Query& query : queries)
+				checksum += scan(query);
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / (static_cast<double>(RUNS) * queries.size() * enemyCount);
+	}
+
+	void runBenchmark(int enemyCount)
+	{
+		std::mt19937 generator(1234);
+		std::uniform_int_distribution<int> tileX(0, 40);
+		std::uniform_int_distribution<int> tileY(0, 30);
+		std::uniform_real_distribution<float> coordinate(0.f, 40.f * Grid::TILE_SIZE);
+		std::uniform_real_distribution<float> range(160.f, 400.f);
+
+		EnemyPool pool;
+		std::vector<LegacyEnemy> legacy(enemyCount);
+
+		// Enemies spawn at the start of their path, so give each one a short path of its own
+		Path path;
+		for (int i = 0; i < enemyCount; ++i)
+		{
+			sf::Vector2f start = Utility::tileToPixelPosition(tileX(generator), tileY(generator));
+			path.clear();
+			path.addWaypoint(start);
+			path.addWaypoint(start + sf::Vector2f(Grid::TILE_SIZE, 0.f));
+			pool.spawn(path, EnemyPool::BASE_SPEED, EnemyPool::BASE_HEALTH);
+			legacy[i].positionCurrent = pool.getPixelPosition(i);
+			legacy[i].health = pool.getHealth(i);
+		}
+
+		std::vector<Query> queries(QUERIES_PER_RUN);
+		for (Query& query : queries)
+			query = { { coordinate(generator), coordinate(generator) }, range(generator) };
+
+		long long legacyChecksum = 0;
+		long long poolChecksum = 0;
+
+		double legacyTargeting = measure(queries, enemyCount, legacyChecksum, [&](const Query& q) { return findClosestLegacy(legacy, q); });
+		double poolTargeting = measure(queries, enemyCount, poolChecksum, [&](const Query& q) { return findClosestPool(pool, q); });
+		double legacyCollision = measure(queries, enemyCount, legacyChecksum, [&](const Query& q) { return countCollisionsLegacy(legacy, q); });
+		double poolCollision = measure(queries, enemyCount, poolChecksum, [&](const Query& q) { return countCollisionsPool(pool, q); });
+
+		if (legacyChecksum != poolChecksum)
+			std::cerr << "Warning: layouts disagree on results!" << std::endl;
+
+		std::cout << std::fixed << std::setprecision(3)
+			<< std::setw(8) << enemyCount << " enemies | targeting: "
+			<< legacyTargeting << " ns -> " << poolTargeting << " ns (x" << std::setprecision(2) << legacyTargeting / poolTargeting << ")"
+			<< std::setprecision(3) << " | collision: "
+			<< legacyCollision << " ns -> " << poolCollision << " ns (x" << std::setprecision(2) << legacyCollision / poolCollision << ")"
+			<< std::endl;
+	}
+}
+
+int main()
+{
+	std::cout << "Time per enemy visited, array-of-structures -> EnemyPool (sizeof old enemy: "
+		<< sizeof(LegacyEnemy) << " bytes)" << std::endl;
+
+	runBenchmark(1000);
+	runBenchmark(10000);
+
+	return 0;
+}
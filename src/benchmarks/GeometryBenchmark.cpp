@@ -0,0 +1,142 @@
+// ================================================================================================
+// File: GeometryBenchmark.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// Description: Micro-benchmark of the Geometry range test against the per-point tests it replaced.
+//              Each run finds the points within a tower-sized radius of many query centers, over
+//              point arrays from the size of a spatial hash bucket up to a whole large wave:
+//              Utility::distance (hypotf) against the radius, the squared distance against the
+//              squared radius one point at a time, and Geometry::findWithinRadius. All three must
+//              find the same points.
+//              Usage: GeometryBenchmark
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../core/Geometry.hpp"
+#include "../core/Utility.hpp"
+
+namespace
+{
+	const double SECONDS_PER_TEST = 0.5;
+	const int QUERIES = 64;
+
+	struct Points
+	{
+		std::vector<float> x;
+		std::vector<float> y;
+	};
+
+	struct Query
+	{
+		sf::Vector2f center;
+		float radius;
+		float radiusSquared;
+	};
+
+	int countWithHypot(const Points& points, const Query& query, std::vector<int>& hits)
+	{
+		int hitCount = 0;
+		for (int i = 0; i < static_cast<int>(points.x.size()); ++i)
+			if (Utility::distance(query.center, { points.x[i], points.y[i] }) <= query.radius)
+				hits[hitCount++] = i;
+		return hitCount;
+	}
+
+	int countWithSquares(const Points& points, const Query& query, std::vector<int>& hits)
+	{
+		int hitCount = 0;
+		for (int i = 0; i < static_cast<int>(points.x.size()); ++i)
+			if (Utility::distanceSquared(query.center, { points.x[i], points.y[i] }) <= query.radiusSquared)
+				hits[hitCount++] = i;
+		return hitCount;
+	}
+
+	// Runs every query over the points for a fixed time and returns the time per point tested
+	template <typename Test>
+	double measure(const std::vector<Query>& queries, int pointCount, long long& checksum, Test test)
+	{
+		long long pointsTested = 0;
+		long long hits = 0;
+		auto start = std::chrono::steady_clock::now();
+		std::chrono::duration<double> elapsed(0.0);
+		while (elapsed.count() < SECONDS_PER_TEST)
+		{
+			for (const Query& query : queries)
+				hits += test(query);
+			pointsTested += static_cast<long long>(queries.size()) * pointCount;
+			elapsed = std::chrono::steady_clock::now() - start;
+		}
+		// Every test ran the queries a different number of times, so only one pass is compared
+		long long onePass = 0;
+		for (const Query& query : queries)
+			onePass += test(query);
+		checksum += onePass;
+		return elapsed.count() * 1e9 / pointsTested;
+	}
+
+	void runBenchmark(int pointCount)
+	{
+		std::mt19937 generator(1234);
+		std::uniform_real_distribution<float> coordinate(0.f, 4000.f);
+		std::uniform_real_distribution<float> range(160.f, 400.f);
+
+		// Small arrays stand for the contents of one bucket, so keep their points close together
+		float spread = pointCount <= 64 ? 400.f : 4000.f;
+		std::uniform_real_distribution<float> offset(0.f, spread);
+		Points points;
+		for (int i = 0; i < pointCount; ++i)
+		{
+			points.x.push_back(offset(generator));
+			points.y.push_back(offset(generator));
+		}
+
+		std::vector<Query> queries(QUERIES);
+		for (Query& query : queries)
+		{
+			query.center = { coordinate(generator) * spread / 4000.f, coordinate(generator) * spread / 4000.f };
+			query.radius = range(generator);
+			query.radiusSquared = query.radius * query.radius;
+		}
+
+		std::vector<int> hits(pointCount);
+		std::vector<float> hitDistancesSquared(pointCount);
+		long long hypotChecksum = 0, squaresChecksum = 0, kernelChecksum = 0;
+
+		double hypot = measure(queries, pointCount, hypotChecksum, [&](const Query& q) { return countWithHypot(points, q, hits); });
+		double squares = measure(queries, pointCount, squaresChecksum, [&](const Query& q) { return countWithSquares(points, q, hits); });
+		double kernel = measure(queries, pointCount, kernelChecksum, [&](const Query& q)
+			{
+				return Geometry::findWithinRadius(points.x.data(), points.y.data(), pointCount, q.center, q.radiusSquared,
+					hits.data(), hitDistancesSquared.data());
+			});
+
+		if (hypotChecksum != squaresChecksum || squaresChecksum != kernelChecksum)
+			std::cerr << "Warning: the tests disagree on the points in range!" << std::endl;
+
+		std::cout << std::fixed << std::setprecision(3)
+			<< std::setw(6) << pointCount << " points | hypot: " << hypot << " ns | squared: " << squares
+			<< " ns (x" << std::setprecision(2) << hypot / squares << ") | Geometry: " << std::setprecision(3) << kernel
+			<< " ns (x" << std::setprecision(2) << hypot / kernel << ")" << std::endl;
+	}
+}
+
+int main()
+{
+	std::cout << "Time per point tested against a radius (Geometry kernels "
+		<< (Geometry::isVectorized() ? "use SSE2" : "are not vectorized on this target") << ")" << std::endl;
+
+	runBenchmark(4);
+	runBenchmark(16);
+	runBenchmark(64);
+	runBenchmark(1024);
+	runBenchmark(16384);
+
+	return 0;
+}
@@ -0,0 +1,169 @@
+// ================================================================================================
+// File: LevelGenerationBenchmark.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 19, 2025
+// Description: Benchmark of level generation across grid sizes. Compares Grid's generator, which
+//              reaches every row by construction, against the previous rejection loop, which
+//              regenerated the whole level until the path happened to have a tile in every row.
+//              Both build the tile types only; the tile layer is built lazily when rendering. Grid
+//              also lays out the enemy path, which the copy of the rejection loop does not.
+//              A thousand levels of every size are checked for a path tile in every row.
+//              Usage: LevelGenerationBenchmark
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "../core/Grid.hpp"
+
+namespace
+{
+	const double SECONDS_PER_SIZE = 0.5;
+	const int VALIDATED_LEVELS = 1000;
+
+	// The previous generator: a random walk from left to right, retried until it covers every row
+	int generateWithRejection(int cols, int rows, Rng& rng, std::vector<Tile::Type>& tiles)
+	{
+		int attempts = 0;
+		bool doAllRowsHavePathableTiles = false;
+
+		while (!doAllRowsHavePathableTiles)
+		{
+			attempts++;
+			std::vector<Tile::Type> level(static_cast<size_t>(cols) * rows, Tile::Type::Unassigned);
+
+			std::vector<bool> rowHasPathableTile(rows, false);
+			rowHasPathableTile[0] = true;
+			rowHasPathableTile[size_t(rows - 1)] = true;
+
+			int currentRow = rng.range(1, rows - 2);
+			level[currentRow * cols] = Tile::Type::Start;
+
+			int previousTileDirection = 0;
+
+			for (int col = 1; col < cols; ++col)
+			{
+				int previousRow = currentRow;
+				int roll = rng.range(0, 9);
+				int verticalSteps = rng.range(1, rows);
+				int nextTileDirection = 0;
+
+				if (col != cols - 1)
+				{
+					if (roll < 5 && previousTileDirection != 1)
+						nextTileDirection = -1;
+					else if (roll > 4 && previousTileDirection != -1)
+						nextTileDirection = 1;
+				}
+
+				previousTileDirection = nextTileDirection;
+
+				for (int i = 0; i < verticalSteps; ++i)
+				{
+					currentRow = std::clamp(currentRow + nextTileDirection, 1, rows - 2);
+					level[currentRow * cols + col] = Tile::Type::Pathable;
+					rowHasPathableTile[currentRow] = true;
+				}
+
+				if (currentRow != previousRow)
+				{
+					int step = (currentRow > previousRow) ? 1 : -1;
+					for (int row = previousRow; row != currentRow; row += step)
+						level[row * cols + col] = Tile::Type::Pathable;
+				}
+
+				level[currentRow * cols + col] = (col != cols - 1) ? Tile::Type::Pathable : Tile::Type::End;
+			}
+
+			doAllRowsHavePathableTiles = std::all_of(rowHasPathableTile.begin(), rowHasPathableTile.end(), [](bool hasPathableTile) { return hasPathableTile; });
+
+			std::replace(level.begin(), level.end(), Tile::Type::Unassigned, Tile::Type::Buildable);
+			tiles = std::move(level);
+		}
+		return attempts;
+	}
+
+	bool isPathTile(Tile::Type type)
+	{
+		return type == Tile::Type::Start || type == Tile::Type::Pathable || type == Tile::Type::End;
+	}
+
+	bool doAllRowsHavePathTiles(const Grid& grid)
+	{
+		const sf::Vector2i size(grid.getSize());
+		for (int row = 1; row < size.y - 1; ++row)
+		{
+			bool hasPathTile = false;
+			for (int col = 0; col < size.x && !hasPathTile; ++col)
+				hasPathTile = isPathTile(grid.getTileType(col, row));
+			if (!hasPathTile)
+				return false;
+		}
+		return true;
+	}
+
+	// Generates levels for a fixed time and returns how many were made per second
+	template <typename Generate>
+	double measure(Generate generate)
+	{
+		long long levels = 0;
+		auto start = std::chrono::steady_clock::now();
+		std::chrono::duration<double> elapsed(0.0);
+		while (elapsed.count() < SECONDS_PER_SIZE)
+		{
+			for (int i = 0; i < 16; ++i)
+				generate();
+			levels += 16;
+			elapsed = std::chrono::steady_clock::now() - start;
+		}
+		return levels / elapsed.count();
+	}
+
+	void runBenchmark(int cols, int rows)
+	{
+		Rng rng(1234);
+		std::vector<Tile::Type> tiles;
+		long long attempts = 0;
+		long long rejectionLevels = 0;
+		double rejectionRate = measure([&]() { attempts += generateWithRejection(cols, rows, rng, tiles); rejectionLevels++; });
+
+		rng.seed(1234);
+		Grid grid(cols, rows, rng);
+		double constructiveRate = measure([&]() { grid.generateNewRandomLevel(cols, rows, rng); });
+
+		// Checked apart from the timing, as the check costs about as much as generating
+		bool isValid = true;
+		for (int i = 0; i < VALIDATED_LEVELS && isValid; ++i)
+		{
+			grid.generateNewRandomLevel(cols, rows, rng);
+			isValid = doAllRowsHavePathTiles(grid);
+		}
+		if (!isValid)
+			std::cerr << "Warning: a generated " << cols << "x" << rows << " level has a row without a path tile!" << std::endl;
+
+		std::cout << std::fixed << std::setprecision(0)
+			<< std::setw(4) << cols << "x" << std::left << std::setw(4) << rows << std::right << " | rejection: "
+			<< std::setw(9) << rejectionRate << " levels/s (" << std::setprecision(2)
+			<< static_cast<double>(attempts) / rejectionLevels << " attempts/level) | by construction: "
+			<< std::setprecision(0) << std::setw(9) << constructiveRate << " levels/s (x" << std::setprecision(2)
+			<< constructiveRate / rejectionRate << ")" << std::endl;
+	}
+}
+
+int main()
+{
+	std::cout << "Levels generated per second, previous rejection loop -> Grid::generateNewRandomLevel" << std::endl;
+
+	runBenchmark(10, 8);
+	runBenchmark(40, 30);
+	runBenchmark(100, 75);
+	runBenchmark(200, 150);
+	runBenchmark(400, 300);
+
+	return 0;
+}
@@ -0,0 +1,201 @@
+// ================================================================================================
+// File: AssetArchive.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 23, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include "AssetArchive.hpp"
+#include "AssetManifest.hpp"
+
+const char AssetArchive::MAGIC[4] = { 'T', 'D', 'P', 'K' };
+const std::uint8_t AssetArchive::VERSION = 1;
+
+namespace
+{
+	const std::size_t HEADER_SIZE = 12;
+	const std::size_t ENTRY_SIZE = 32;
+	const std::size_t MAX_CHANNELS = 8;
+	const std::size_t DATA_ALIGNMENT = 8; // Keeps the samples suitably aligned for reading in place
+
+	void writeU32(std::vector<std::uint8_t>& out, std::size_t offset, std::uint32_t value)
+	{
+		for (int i = 0; i < 4; ++i)
+			out[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+	}
+
+	void writeU64(std::vector<std::uint8_t>& out, std::size_t offset, std::uint64_t value)
+	{
+		for (int i = 0; i < 8; ++i)
+			out[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+	}
+
+	std::uint32_t readU32(const std::uint8_t* in)
+	{
+		std::uint32_t value = 0;
+		for (int i = 0; i < 4; ++i)
+			value |= static_cast<std::uint32_t>(in[i]) << (8 * i);
+		return value;
+	}
+
+	std::uint64_t readU64(const std::uint8_t* in)
+	{
+		std::uint64_t value = 0;
+		for (int i = 0; i < 8; ++i)
+			value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+		return value;
+	}
+
+	// Pads the data so the next blob starts on an aligned offset, then appends the blob and
+	// returns its offset
+	std::size_t appendBlob(std::vector<std::uint8_t>& out, const std::uint8_t* data, std::size_t size)
+	{
+		out.resize((out.size() + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT, 0);
+		std::size_t offset = out.size();
+		out.insert(out.end(), data, data + size);
+		return offset;
+	}
+}
+
+bool AssetArchive::open(const std::string& filename)
+{
+	entries.clear();
+	if (!file.open(filename))
+		return false;
+
+	const std::uint8_t* data = file.getData();
+	const std::size_t size = file.getSize();
+
+	if (size < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), data))
+	{
+		std::cerr << "Error: " << filename << " is not an asset archive!" << std::endl;
+		file.close();
+		return false;
+	}
+	if (data[sizeof(MAGIC)] != VERSION)
+	{
+		std::cerr << "Error: Unsupported asset archive version " << static_cast<int>(data[sizeof(MAGIC)]) << "!" << std::endl;
+		file.close();
+		return false;
+	}
+
+	const std::uint32_t count = readU32(data + 8);
+	bool isValid = size >= HEADER_SIZE + count * ENTRY_SIZE;
+
+	for (std::uint32_t i = 0; isValid && i < count; ++i)
+	{
+		const std::uint8_t* index = data + HEADER_SIZE + i * ENTRY_SIZE;
+		std::uint64_t offset = readU64(index + 8);
+		std::uint64_t blobSize = readU64(index + 16);
+		unsigned channelCount = index[2];
+
+		isValid = offset <= size && blobSize <= size - offset && channelCount <= MAX_CHANNELS &&
+			index[0] <= static_cast<std::uint8_t>(EntryType::Sound) &&
+			index[1] < static_cast<std::uint8_t>(SoundID::Count);
+		if (!isValid)
+			break;
+
+		Entry entry;
+		entry.type = static_cast<EntryType>(index[0]);
+		entry.soundID = static_cast<SoundID>(index[1]);
+		entry.sampleRate = readU32(index + 4);
+		for (unsigned channel = 0; channel < channelCount; ++channel)
+			entry.channels.push_back(static_cast<sf::SoundChannel>(index[24 + channel]));
+		entry.data = data + offset;
+		entry.size = static_cast<std::size_t>(blobSize);
+		entries.push_back(entry);
+	}
+
+	if (!isValid)
+	{
+		std::cerr << "Error: Asset archive " << filename << " is truncated or corrupt!" << std::endl;
+		entries.clear();
+		file.close();
+		return false;
+	}
+	return true;
+}
+
+const AssetArchive::Entry* AssetArchive::findFont() const
+{
+	auto it = std::find_if(entries.begin(), entries.end(),
+		[](const Entry& entry) { return entry.type == EntryType::Font; });
+	return it != entries.end() ? &*it : nullptr;
+}
+
+const AssetArchive::Entry* AssetArchive::findSound(SoundID soundID) const
+{
+	auto it = std::find_if(entries.begin(), entries.end(),
+		[soundID](const Entry& entry) { return entry.type == EntryType::Sound && entry.soundID == soundID; });
+	return it != entries.end() ? &*it : nullptr;
+}
+
+bool AssetArchive::pack(const std::string& filename)
+{
+	const std::vector<AssetManifest::SoundAsset>& sounds = AssetManifest::getSounds();
+	const std::uint32_t count = static_cast<std::uint32_t>(sounds.size() + 1);
+
+	std::vector<std::uint8_t> out(HEADER_SIZE + count * ENTRY_SIZE, 0);
+	std::copy(std::begin(MAGIC), std::end(MAGIC), out.begin());
+	out[sizeof(MAGIC)] = VERSION;
+	writeU32(out, 8, count);
+
+	// The font is stored as is; FreeType reads it straight from the mapping
+	std::ifstream fontFile(AssetManifest::getFontPath(), std::ios::binary);
+	std::vector<std::uint8_t> fontData((std::istreambuf_iterator<char>(fontFile)), std::istreambuf_iterator<char>());
+	if (!fontFile.is_open() || fontData.empty())
+	{
+		std::cerr << "Error: Could not read font " << AssetManifest::getFontPath() << "!" << std::endl;
+		return false;
+	}
+
+	std::size_t index = HEADER_SIZE;
+	out[index] = static_cast<std::uint8_t>(EntryType::Font);
+	writeU64(out, index + 8, appendBlob(out, fontData.data(), fontData.size()));
+	writeU64(out, index + 16, fontData.size());
+	index += ENTRY_SIZE;
+
+	for (const AssetManifest::SoundAsset& asset : sounds)
+	{
+		sf::SoundBuffer buffer;
+		if (!buffer.loadFromFile(asset.path))
+		{
+			std::cerr << "Error: Could not load sound " << asset.path << "!" << std::endl;
+			return false;
+		}
+
+		std::vector<sf::SoundChannel> channels = buffer.getChannelMap();
+		if (channels.size() > MAX_CHANNELS)
+		{
+			std::cerr << "Error: Sound " << asset.path << " has more than " << MAX_CHANNELS << " channels!" << std::endl;
+			return false;
+		}
+
+		const std::size_t sampleBytes = static_cast<std::size_t>(buffer.getSampleCount()) * sizeof(std::int16_t);
+		std::size_t offset = appendBlob(out, reinterpret_cast<const std::uint8_t*>(buffer.getSamples()), sampleBytes);
+
+		out[index] = static_cast<std::uint8_t>(EntryType::Sound);
+		out[index + 1] = static_cast<std::uint8_t>(asset.id);
+		out[index + 2] = static_cast<std::uint8_t>(channels.size());
+		writeU32(out, index + 4, buffer.getSampleRate());
+		writeU64(out, index + 8, offset);
+		writeU64(out, index + 16, sampleBytes);
+		for (std::size_t channel = 0; channel < channels.size(); ++channel)
+			out[index + 24 + channel] = static_cast<std::uint8_t>(channels[channel]);
+		index += ENTRY_SIZE;
+	}
+
+	std::ofstream file(filename, std::ios::binary);
+	if (!file.write(reinterpret_cast<const char*>(out.data()), out.size()))
+	{
+		std::cerr << "Error: Could not write asset archive to " << filename << std::endl;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,61 @@
+// ================================================================================================
+// File: AssetArchive.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 23, 2025
+// Description: Defines the AssetArchive class, which reads and writes the packed asset archive.
+//              The archive holds every asset in the AssetManifest in a single file: the font as its
+//              raw file bytes and each sound as already decoded 16-bit PCM samples, so loading is
+//              a matter of pointing SFML at the memory-mapped data.
+//              Layout (little-endian): "TDPK", version byte, 3 reserved bytes, u32 entry count,
+//              then one 32-byte index entry per asset, then the asset data, each aligned to 8 bytes.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include "MappedFile.hpp"
+#include "../audio/SoundID.hpp"
+
+class AssetArchive
+{
+public:
+	enum class EntryType : std::uint8_t
+	{
+		Font,
+		Sound
+	};
+
+	struct Entry
+	{
+		EntryType type;
+		SoundID soundID;          // Only used by sounds
+		unsigned sampleRate;                    // Only used by sounds
+		std::vector<sf::SoundChannel> channels; // Only used by sounds
+		const std::uint8_t* data;
+		std::size_t size;
+	};
+
+	// Maps the archive into memory and reads its index. Returns false if it could not be opened.
+	bool open(const std::string& filename);
+
+	// Return nullptr if the archive has no such asset
+	const Entry* findFont() const;
+	const Entry* findSound(SoundID soundID) const;
+
+	// Decodes every asset in the manifest and writes them into a new archive
+	static bool pack(const std::string& filename);
+
+	static const char MAGIC[4];
+	static const std::uint8_t VERSION;
+
+private:
+	MappedFile file;
+	std::vector<Entry> entries;
+};
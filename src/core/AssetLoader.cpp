@@ -0,0 +1,156 @@
+// ================================================================================================
+// File: AssetLoader.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 22, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include "AssetLoader.hpp"
+#include "AssetManifest.hpp"
+
+AssetLoader::AssetLoader(const std::string& archivePath) :
+	startTime(std::chrono::steady_clock::now()),
+	archivePath(archivePath),
+	isLoadedFromArchive(false),
+	fontMilliseconds(0.f),
+	soundsFinishedAt(-1.f),
+	firstFrameAt(-1.f)
+{
+	if (archive.open(archivePath))
+	{
+		loadFromArchive();
+	}
+	else
+	{
+		std::cerr << "Warning: No asset archive at " << archivePath << ", loading the asset files instead" << std::endl;
+		loadFromFiles();
+	}
+}
+
+void AssetLoader::loadFromArchive()
+{
+	isLoadedFromArchive = true;
+
+	// Nothing is left to decode, so this is cheap enough to do right away on the calling thread
+	auto start = std::chrono::steady_clock::now();
+	const AssetArchive::Entry* fontEntry = archive.findFont();
+	if (!fontEntry || !font.openFromMemory(fontEntry->data, fontEntry->size))
+		std::cerr << "Error: Could not load font from " << archivePath << "!" << std::endl;
+	fontMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	for (const AssetManifest::SoundAsset& asset : AssetManifest::getSounds())
+	{
+		start = std::chrono::steady_clock::now();
+		const AssetArchive::Entry* entry = archive.findSound(asset.id);
+		auto buffer = std::make_shared<sf::SoundBuffer>();
+		if (!entry || !buffer->loadFromSamples(reinterpret_cast<const std::int16_t*>(entry->data),
+			entry->size / sizeof(std::int16_t), static_cast<unsigned>(entry->channels.size()), entry->sampleRate, entry->channels))
+		{
+			std::cerr << "Error: Could not load sound " << asset.path << " from " << archivePath << "!" << std::endl;
+			buffer = nullptr;
+		}
+		float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		sounds.push_back({ asset.id, asset.path, buffer, milliseconds });
+	}
+}
+
+void AssetLoader::loadFromFiles()
+{
+	fontLoaded = std::async(std::launch::async, [this]
+		{
+			auto start = std::chrono::steady_clock::now();
+			bool isLoaded = font.openFromFile(AssetManifest::getFontPath());
+			fontMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			if (!isLoaded)
+				std::cerr << "Error: Could not load font " << AssetManifest::getFontPath() << "!" << std::endl;
+			return isLoaded;
+		});
+
+	// Each sound is decoded on its own thread; the outer task is the completion future for all of them
+	soundsLoaded = std::async(std::launch::async, []
+		{
+			std::vector<std::future<LoadedSound>> pending;
+			for (const AssetManifest::SoundAsset& asset : AssetManifest::getSounds())
+			{
+				pending.push_back(std::async(std::launch::async, [asset]
+					{
+						auto start = std::chrono::steady_clock::now();
+						auto buffer = std::make_shared<sf::SoundBuffer>();
+						if (!buffer->loadFromFile(asset.path))
+						{
+							std::cerr << "Error: Could not load sound " << asset.path << "!" << std::endl;
+							buffer = nullptr;
+						}
+						float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+						return LoadedSound{ asset.id, asset.path, buffer, milliseconds };
+					}));
+			}
+
+			std::vector<LoadedSound> loaded;
+			loaded.reserve(pending.size());
+			for (auto& sound : pending)
+				loaded.push_back(sound.get());
+			return loaded;
+		});
+}
+
+const sf::Font& AssetLoader::waitForFont()
+{
+	if (fontLoaded.valid())
+		fontLoaded.get();
+	return font;
+}
+
+bool AssetLoader::isFinished() const
+{
+	return !soundsLoaded.valid() || soundsLoaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void AssetLoader::installSounds(SoundManager& soundManager)
+{
+	if (soundsLoaded.valid())
+		sounds = soundsLoaded.get();
+	soundsFinishedAt = getMillisecondsSinceStart();
+
+	std::unordered_map<SoundManager::SoundID, std::shared_ptr<sf::SoundBuffer>> buffers;
+	for (const LoadedSound& sound : sounds)
+	{
+		if (sound.buffer)
+			buffers[sound.id] = sound.buffer;
+	}
+	soundManager.setSounds(std::move(buffers));
+}
+
+void AssetLoader::markFirstFrame()
+{
+	if (firstFrameAt < 0.f)
+		firstFrameAt = getMillisecondsSinceStart();
+}
+
+std::string AssetLoader::getTimingReport() const
+{
+	std::stringstream ss;
+	ss.precision(1);
+	ss << std::fixed << "Startup (" << (isLoadedFromArchive ? "asset archive" : "asset files") << "): first frame at "
+		<< firstFrameAt << " ms, font " << fontMilliseconds << " ms";
+
+	if (soundsFinishedAt >= 0.f && !sounds.empty())
+	{
+		auto slowest = std::max_element(sounds.begin(), sounds.end(),
+			[](const LoadedSound& a, const LoadedSound& b) { return a.milliseconds < b.milliseconds; });
+		ss << ", " << sounds.size() << " sounds ready at " << soundsFinishedAt << " ms (slowest: "
+			<< slowest->path << ", " << slowest->milliseconds << " ms)";
+	}
+	return ss.str();
+}
+
+float AssetLoader::getMillisecondsSinceStart() const
+{
+	return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
@@ -0,0 +1,76 @@
+// ================================================================================================
+// File: AssetLoader.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 22, 2025
+// Description: Defines the AssetLoader class, which loads the assets in the AssetManifest as soon
+//              as it is created. If the packed asset archive exists, it is memory-mapped and the
+//              already decoded assets are handed to SFML straight from the mapping. Otherwise the
+//              files are loaded on background threads: the font is waited for right away, since
+//              the main menu needs it, while the sounds keep decoding as the menu is shown and
+//              gameplay waits for them. Load times are kept for the startup timing report.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Font.hpp>
+#include "AssetArchive.hpp"
+#include "../audio/SoundManager.hpp"
+
+class AssetLoader
+{
+public:
+	// Starts loading every asset in the manifest, from the archive at the given path if there is one
+	AssetLoader(const std::string& archivePath);
+	AssetLoader(const AssetLoader&) = delete;
+	AssetLoader& operator=(const AssetLoader&) = delete;
+
+	// Blocks until the font has been loaded
+	const sf::Font& waitForFont();
+	// Returns true once every asset has finished loading, whether it succeeded or not
+	bool isFinished() const;
+	// Hands the loaded sounds to the sound manager. Blocks until they have finished loading.
+	void installSounds(SoundManager& soundManager);
+
+	// Marks the time the first frame was shown, for the timing report
+	void markFirstFrame();
+	// Returns a one-line summary of how long startup took, measured from construction
+	std::string getTimingReport() const;
+
+private:
+	struct LoadedSound
+	{
+		SoundManager::SoundID id;
+		std::string path;
+		std::shared_ptr<sf::SoundBuffer> buffer; // nullptr if loading failed
+		float milliseconds;
+	};
+
+	void loadFromArchive();
+	void loadFromFiles();
+	float getMillisecondsSinceStart() const;
+
+	std::chrono::steady_clock::time_point startTime;
+
+	// Must outlive everything loaded from it; the font keeps reading from the mapping
+	std::string archivePath;
+	AssetArchive archive;
+	bool isLoadedFromArchive;
+
+	sf::Font font;
+	float fontMilliseconds;
+	std::future<bool> fontLoaded;
+
+	// Completes once every sound has been decoded
+	std::future<std::vector<LoadedSound>> soundsLoaded;
+	std::vector<LoadedSound> sounds;
+	float soundsFinishedAt;
+	float firstFrameAt;
+};
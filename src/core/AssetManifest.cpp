@@ -0,0 +1,45 @@
+// ================================================================================================
+// File: AssetManifest.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 22, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <filesystem>
+#include "AssetManifest.hpp"
+
+std::string AssetManifest::getArchivePath(const std::string& executablePath)
+{
+	return (std::filesystem::path(executablePath).parent_path() / "assets.pak").string();
+}
+
+const std::string& AssetManifest::getFontPath()
+{
+	static const std::string path = "assets/fonts/BRLNSR.TTF";
+	return path;
+}
+
+const std::vector<AssetManifest::SoundAsset>& AssetManifest::getSounds()
+{
+	static const std::vector<SoundAsset> sounds = {
+		{ SoundID::BULLET_SHOOT,   "assets/sounds/bullet-shoot.wav" },
+		{ SoundID::SPLASH_SHOOT,   "assets/sounds/splash-shoot.wav" },
+		{ SoundID::SPLASH_EXPLODE, "assets/sounds/splash-explosion.wav" },
+		{ SoundID::SLOW_PULSE,     "assets/sounds/slow-pulse.wav" },
+		{ SoundID::LIFE_LOST,      "assets/sounds/life-lost.wav" },
+		{ SoundID::NEW_WAVE,       "assets/sounds/new-wave.wav" },
+		{ SoundID::ENEMY_HIT,      "assets/sounds/enemy-hit.wav" },
+		{ SoundID::ENEMY_DEATH,    "assets/sounds/enemy-death.wav" },
+		{ SoundID::TOWER_UPGRADE,  "assets/sounds/tower-upgrade.wav" },
+		{ SoundID::BUTTON_CLICK,   "assets/sounds/button-click.wav" }
+	};
+	return sounds;
+}
+
+const std::string& AssetManifest::getBalancePath()
+{
+	static const std::string path = "assets/data/balance.txt";
+	return path;
+}
@@ -0,0 +1,36 @@
+// ================================================================================================
+// File: AssetManifest.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 22, 2025
+// Description: Defines the AssetManifest namespace, which lists every asset file the game loads at
+//              startup. The AssetLoader loads everything listed here in the background, from the
+//              packed archive built by the asset packer if there is one, or else from the files.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../audio/SoundID.hpp"
+
+namespace AssetManifest
+{
+	struct SoundAsset
+	{
+		SoundID id;
+		std::string path;
+	};
+
+	// The archive the asset packer writes everything below into. The build puts it next to the
+	// executables, so it is found relative to the running one.
+	std::string getArchivePath(const std::string& executablePath);
+	const std::string& getFontPath();
+	const std::vector<SoundAsset>& getSounds();
+
+	// The balance definitions. Not packed into the archive, so they can be edited (and, in debug
+	// builds, reloaded) without rebuilding.
+	const std::string& getBalancePath();
+}
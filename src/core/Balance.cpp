@@ -0,0 +1,284 @@
+// ================================================================================================
+// File: Balance.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 25, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include "Balance.hpp"
+#include "../entities/EnemyPool.hpp"
+
+namespace
+{
+	const float UNLIMITED = std::numeric_limits<float>::max();
+
+	// Splits a definitions file into lines of whitespace separated tokens, in place. Comments are
+	// dropped; tokens are null-terminated so numbers can be read straight out of the buffer.
+	class Tokenizer
+	{
+	public:
+		explicit Tokenizer(std::string& text) : position(text.data()), end(text.data() + text.size()), lineNumber(0) {}
+
+		// Moves to the next line that has any tokens. Returns false at the end of the file.
+		bool nextLine(std::vector<const char*>& tokens)
+		{
+			tokens.clear();
+			while (tokens.empty() && position < end)
+			{
+				lineNumber++;
+				bool isComment = false;
+				while (position < end && *position != '\n')
+				{
+					if (*position == '#')
+						isComment = true;
+					if (isComment || std::isspace(static_cast<unsigned char>(*position)))
+					{
+						*position++ = '\0';
+						continue;
+					}
+					tokens.push_back(position);
+					while (position < end && *position != '\n' && *position != '#' && !std::isspace(static_cast<unsigned char>(*position)))
+						position++;
+				}
+				if (position < end)
+					*position++ = '\0';
+			}
+			return !tokens.empty();
+		}
+
+		inline int getLineNumber() const { return lineNumber; }
+
+	private:
+		char* position;
+		char* end;
+		int lineNumber;
+	};
+
+	bool parseNumber(const char* token, float& value)
+	{
+		char* parsedEnd = nullptr;
+		value = std::strtof(token, &parsedEnd);
+		return parsedEnd != token && *parsedEnd == '\0' && std::isfinite(value);
+	}
+}
+
+template <typename Owner>
+void Balance::Field<Owner>::set(Owner& owner, float value) const
+{
+	if (integer)
+		owner.*integer = static_cast<int>(std::lround(value));
+	else
+		owner.*real = value;
+}
+
+template struct Balance::Field<Balance>;
+template struct Balance::Field<TowerRegistry::AttributesPerLevel>;
+
+Balance::Balance() :
+	startingLives(5),
+	startingGold(100),
+	timeBetweenWaves(10.f),
+	enemyCount(5),
+	enemyCountPerWave(1),
+	timeBetweenEnemies(0.7f),
+	timeBetweenEnemiesPerWave(-0.01f),
+	enemySpeed(EnemyPool::BASE_SPEED),
+	enemySpeedPerWave(0.15f),
+	enemyHealth(static_cast<float>(EnemyPool::BASE_HEALTH)),
+	enemyHealthPerWave(1.f / 3.f)
+{
+	for (const TowerRegistry::TowerMetadata& metadata : TowerRegistry::getTowerMetadataRegistry())
+		towerAttributes.push_back(metadata.attributes);
+}
+
+bool Balance::loadFromFile(const std::string& filename)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if (!file)
+	{
+		std::cerr << "Error: Could not open " << filename << "!" << std::endl;
+		return false;
+	}
+	std::ostringstream contents;
+	contents << file.rdbuf();
+	std::string text = contents.str();
+
+	Balance loaded;
+	const int towerTypeCount = static_cast<int>(TowerRegistry::Type::Count);
+	loaded.towerAttributes.assign(static_cast<size_t>(towerTypeCount), {});
+
+	const std::vector<ValueField>& valueFields = getValueFields();
+	const std::vector<AttributeField>& attributeFields = getAttributeFields();
+	std::vector<bool> isValueGiven(valueFields.size(), false);
+	std::vector<bool> isTowerGiven(static_cast<size_t>(towerTypeCount), false);
+	TowerRegistry::Type currentTower = TowerRegistry::Type::Count;
+	int errorCount = 0;
+
+	auto reportError = [&](int line, const std::string& message)
+		{
+			// Values that are missing altogether have no line to point at
+			std::cerr << "Error: " << filename << (line > 0 ? ":" + std::to_string(line) : "") << ": " << message << std::endl;
+			errorCount++;
+		};
+	auto checkRange = [&](int line, const std::string& name, float value, float min, float max)
+		{
+			if (value < min || value > max)
+			{
+				std::ostringstream ss;
+				ss << name << " is " << value << ", but must be between " << min << " and " << max;
+				reportError(line, ss.str());
+			}
+		};
+
+	Tokenizer tokenizer(text);
+	std::vector<const char*> tokens;
+	while (tokenizer.nextLine(tokens))
+	{
+		const int line = tokenizer.getLineNumber();
+		const std::string key = tokens[0];
+
+		if (key == "tower")
+		{
+			currentTower = tokens.size() == 2 ? findTowerType(tokens[1]) : TowerRegistry::Type::Count;
+			if (currentTower == TowerRegistry::Type::Count)
+				reportError(line, "expected \"tower NAME\" with the name of a tower type");
+			else if (isTowerGiven[static_cast<int>(currentTower)])
+				reportError(line, std::string("tower ") + tokens[1] + " is defined twice");
+			else
+				isTowerGiven[static_cast<int>(currentTower)] = true;
+		}
+		else if (key == "level")
+		{
+			if (currentTower == TowerRegistry::Type::Count)
+			{
+				reportError(line, "a level has to follow a \"tower NAME\" line");
+				continue;
+			}
+			if (tokens.size() != attributeFields.size() + 1)
+			{
+				reportError(line, "a level needs " + std::to_string(attributeFields.size()) + " values");
+				continue;
+			}
+
+			TowerRegistry::AttributesPerLevel level = {};
+			for (std::size_t i = 0; i < attributeFields.size(); ++i)
+			{
+				float value = 0.f;
+				if (!parseNumber(tokens[i + 1], value))
+					reportError(line, std::string(attributeFields[i].name) + " is not a number: " + tokens[i + 1]);
+				else
+					checkRange(line, attributeFields[i].name, value, attributeFields[i].min, attributeFields[i].max);
+				attributeFields[i].set(level, value);
+			}
+			loaded.towerAttributes[static_cast<int>(currentTower)].push_back(level);
+		}
+		else if (const ValueField* field = findValueField(key))
+		{
+			std::size_t index = static_cast<std::size_t>(field - valueFields.data());
+			float value = 0.f;
+			if (isValueGiven[index])
+				reportError(line, key + " is given twice");
+			else if (tokens.size() != 2 || !parseNumber(tokens[1], value))
+				reportError(line, "expected \"" + key + " NUMBER\"");
+			else
+			{
+				checkRange(line, key, value, field->min, field->max);
+				field->set(loaded, value);
+			}
+			isValueGiven[index] = true;
+		}
+		else
+		{
+			reportError(line, "unknown name " + key);
+		}
+	}
+
+	for (std::size_t i = 0; i < valueFields.size(); ++i)
+		if (!isValueGiven[i])
+			reportError(0, std::string(valueFields[i].name) + " is missing");
+
+	for (const TowerRegistry::TowerMetadata& metadata : TowerRegistry::getTowerMetadataRegistry())
+		if (loaded.getTowerAttributes(metadata.type).empty())
+			reportError(0, "tower " + metadata.name + " has no levels");
+
+	if (errorCount > 0)
+	{
+		std::cerr << "Error: " << filename << " has " << errorCount << " error(s); it was not loaded!" << std::endl;
+		return false;
+	}
+
+	*this = std::move(loaded);
+	return true;
+}
+
+const std::vector<Balance::ValueField>& Balance::getValueFields()
+{
+	static const std::vector<ValueField> fields =
+	{
+		{ "startingLives",             &Balance::startingLives,     nullptr, 1.f,     UNLIMITED },
+		{ "startingGold",              &Balance::startingGold,      nullptr, 0.f,     UNLIMITED },
+		{ "timeBetweenWaves",          nullptr, &Balance::timeBetweenWaves,          0.f,     UNLIMITED },
+		{ "enemyCount",                &Balance::enemyCount,        nullptr, 0.f,     UNLIMITED },
+		{ "enemyCountPerWave",         &Balance::enemyCountPerWave, nullptr, 0.f,     UNLIMITED },
+		{ "timeBetweenEnemies",        nullptr, &Balance::timeBetweenEnemies,        0.f,     UNLIMITED },
+		{ "timeBetweenEnemiesPerWave", nullptr, &Balance::timeBetweenEnemiesPerWave, -UNLIMITED, UNLIMITED },
+		{ "enemySpeed",                nullptr, &Balance::enemySpeed,                1.f,     UNLIMITED },
+		{ "enemySpeedPerWave",         nullptr, &Balance::enemySpeedPerWave,         0.f,     UNLIMITED },
+		{ "enemyHealth",               nullptr, &Balance::enemyHealth,               1.f,     UNLIMITED },
+		{ "enemyHealthPerWave",        nullptr, &Balance::enemyHealthPerWave,        0.f,     UNLIMITED }
+	};
+	return fields;
+}
+
+const std::vector<Balance::AttributeField>& Balance::getAttributeFields()
+{
+	using Attributes = TowerRegistry::AttributesPerLevel;
+
+	static const std::vector<AttributeField> fields =
+	{
+		{ "buyCost",      &Attributes::buyCost,  nullptr, 0.f, UNLIMITED },
+		{ "sellCost",     &Attributes::sellCost, nullptr, 0.f, UNLIMITED },
+		{ "damage",       &Attributes::damage,   nullptr, 0.f, UNLIMITED },
+		{ "range",        nullptr, &Attributes::range,        1.f,   UNLIMITED },
+		{ "fireRate",     nullptr, &Attributes::fireRate,     0.01f, UNLIMITED }, // Seconds between shots
+		{ "splashRadius", nullptr, &Attributes::splashRadius, 0.f,   UNLIMITED },
+		{ "slowAmount",   nullptr, &Attributes::slowAmount,   0.f,   1.f },
+		{ "slowDuration", nullptr, &Attributes::slowDuration, 0.f,   UNLIMITED }
+	};
+	return fields;
+}
+
+const Balance::ValueField* Balance::findValueField(const std::string& name)
+{
+	const std::vector<ValueField>& fields = getValueFields();
+	auto field = std::find_if(fields.begin(), fields.end(), [&](const ValueField& f) { return name == f.name; });
+	return field != fields.end() ? &*field : nullptr;
+}
+
+const Balance::AttributeField* Balance::findAttributeField(const std::string& name)
+{
+	const std::vector<AttributeField>& fields = getAttributeFields();
+	auto field = std::find_if(fields.begin(), fields.end(), [&](const AttributeField& f) { return name == f.name; });
+	return field != fields.end() ? &*field : nullptr;
+}
+
+TowerRegistry::Type Balance::findTowerType(const std::string& name)
+{
+	for (const TowerRegistry::TowerMetadata& metadata : TowerRegistry::getTowerMetadataRegistry())
+	{
+		if (std::equal(name.begin(), name.end(), metadata.name.begin(), metadata.name.end(),
+			[](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b)); }))
+			return metadata.type;
+	}
+	return TowerRegistry::Type::Count;
+}
@@ -0,0 +1,84 @@
+// ================================================================================================
+// File: Balance.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 25, 2025
+// Description: Defines the Balance struct, which holds every number that tunes the difficulty of a
+//              game: the tower tables, the starting lives and gold, and how enemy count, spacing,
+//              speed and health ramp up from wave to wave. A default-constructed Balance holds the
+//              built-in values, with the tower tables taken from the TowerRegistry; the game loads
+//              its values from a definitions file instead (see loadFromFile), so tuning does not
+//              need a recompile. Once loaded, a Balance is shared read-only between simulations
+//              through a std::shared_ptr<const Balance>, so batch tools can play many at once.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../entities/TowerRegistry.hpp"
+
+struct Balance
+{
+	Balance();
+
+	// Replaces all values with those in a definitions file. Every value and every tower type has
+	// to be given exactly once, and each must be in its valid range; otherwise the errors are
+	// printed with their line numbers, this balance is left unchanged and false is returned.
+	// The format is one "name value" pair per line, '#' starting a comment, and for each tower
+	// a "tower NAME" line followed by one "level" line per level with the values in the order of
+	// getAttributeFields(). See assets/data/balance.txt.
+	bool loadFromFile(const std::string& filename);
+
+	inline const std::vector<TowerRegistry::AttributesPerLevel>& getTowerAttributes(TowerRegistry::Type type) const
+	{
+		return towerAttributes[static_cast<int>(type)];
+	}
+
+	// Indexed by TowerRegistry::Type
+	std::vector<std::vector<TowerRegistry::AttributesPerLevel>> towerAttributes;
+
+	int startingLives;
+	int startingGold;
+
+	// Waves. Every wave first applies the per-wave changes to the enemy count and the time between
+	// enemies, so these are the values before the first wave (which has enemyCount + 1 enemies).
+	float timeBetweenWaves;          // Seconds of rest after a wave has finished spawning
+	int enemyCount;
+	int enemyCountPerWave;
+	float timeBetweenEnemies;        // Seconds between spawns within a wave
+	float timeBetweenEnemiesPerWave;
+	// Enemies of wave N spawn with enemySpeed + N * enemySpeedPerWave, and likewise for health
+	float enemySpeed;                // Pixels per second
+	float enemySpeedPerWave;
+	float enemyHealth;
+	float enemyHealthPerWave;
+
+	// A named value, as it appears in definitions files. Exactly one of the member pointers is set.
+	template <typename Owner>
+	struct Field
+	{
+		const char* name;
+		int Owner::* integer;
+		float Owner::* real;
+		float min, max; // Valid range, inclusive
+
+		inline float get(const Owner& owner) const { return integer ? static_cast<float>(owner.*integer) : owner.*real; }
+		// Integers are rounded to the nearest whole number
+		void set(Owner& owner, float value) const;
+	};
+	using ValueField = Field<Balance>;
+	using AttributeField = Field<TowerRegistry::AttributesPerLevel>;
+
+	// The scalar values, in the order they are listed in definitions files
+	static const std::vector<ValueField>& getValueFields();
+	// The tower attributes, in the order they are listed on a "level" line
+	static const std::vector<AttributeField>& getAttributeFields();
+	// Both return nullptr if there is no field with the given name
+	static const ValueField* findValueField(const std::string& name);
+	static const AttributeField* findAttributeField(const std::string& name);
+	// Case insensitive; returns TowerRegistry::Type::Count if no tower has the given name
+	static TowerRegistry::Type findTowerType(const std::string& name);
+};
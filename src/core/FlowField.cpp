@@ -0,0 +1,291 @@
+// ================================================================================================
+// File: FlowField.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include "FlowField.hpp"
+
+const int FlowField::UNREACHABLE = std::numeric_limits<int>::max();
+const int FlowField::OFFSETS_X[DIRECTION_COUNT] = { 1, 0, 0, -1 };
+const int FlowField::OFFSETS_Y[DIRECTION_COUNT] = { 0, 1, -1, 0 };
+
+FlowField::FlowField() :
+	cols(0),
+	rows(0),
+	goal(0, 0)
+{}
+
+void FlowField::build(int cols, int rows, const std::vector<Tile::Type>& tiles, sf::Vector2i goal)
+{
+	this->cols = cols;
+	this->rows = rows;
+	this->goal = goal;
+
+	const int tileCount = cols * rows;
+	distances.assign(tileCount, UNREACHABLE);
+	nextSteps.assign(tileCount, NO_STEP);
+	isBlocked.assign(tileCount, 0);
+	regionSlots.assign(tileCount, -1);
+
+	for (int i = 0; i < tileCount; ++i)
+		isBlocked[i] = tiles[i] == Tile::Type::Tower;
+
+	if (!isInside(goal) || isBlocked[getIndex(goal)])
+		return;
+
+	// The search front doubles as the queue, as every tile enters it once
+	std::vector<int> front;
+	front.reserve(tileCount);
+	front.push_back(getIndex(goal));
+	distances[front.back()] = 0;
+
+	for (std::size_t i = 0; i < front.size(); ++i)
+	{
+		const int current = front[i];
+		for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+		{
+			int neighbour = getNeighbour(current, direction);
+			if (neighbour == -1 || isBlocked[neighbour] || distances[neighbour] != UNREACHABLE)
+				continue;
+
+			distances[neighbour] = distances[current] + 1;
+			front.push_back(neighbour);
+		}
+	}
+
+	for (int i = 0; i < tileCount; ++i)
+		nextSteps[i] = findNextStep(i);
+}
+
+void FlowField::block(sf::Vector2i tile)
+{
+	if (!isInside(tile) || isBlocked[getIndex(tile)])
+		return;
+
+	const int blockedIndex = getIndex(tile);
+	std::vector<int> region;
+	std::vector<int> newDistances;
+	findBlockedRegion(blockedIndex, region, newDistances);
+	releaseRegion(region);
+
+	isBlocked[blockedIndex] = 1;
+	for (std::size_t i = 0; i < region.size(); ++i)
+		distances[region[i]] = newDistances[i];
+
+	updateNextSteps(region);
+}
+
+void FlowField::unblock(sf::Vector2i tile)
+{
+	if (!isInside(tile) || !isBlocked[getIndex(tile)])
+		return;
+
+	const int openedIndex = getIndex(tile);
+	isBlocked[openedIndex] = 0;
+
+	// The opened tile is one step further than its closest neighbour
+	int distance = (tile == goal) ? 0 : UNREACHABLE;
+	for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+	{
+		int neighbour = getNeighbour(openedIndex, direction);
+		if (neighbour != -1 && !isBlocked[neighbour] && distances[neighbour] != UNREACHABLE)
+			distance = std::min(distance, distances[neighbour] + 1);
+	}
+	distances[openedIndex] = distance;
+
+	// Spread the shorter distances out from it; every improvement starts at the opened tile, so
+	// tiles are reached in order of their new distance just like in the full search
+	std::vector<int> changed(1, openedIndex);
+	for (std::size_t i = 0; i < changed.size() && distance != UNREACHABLE; ++i)
+	{
+		const int current = changed[i];
+		for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+		{
+			int neighbour = getNeighbour(current, direction);
+			if (neighbour == -1 || isBlocked[neighbour] || distances[neighbour] <= distances[current] + 1)
+				continue;
+
+			distances[neighbour] = distances[current] + 1;
+			changed.push_back(neighbour);
+		}
+	}
+
+	updateNextSteps(changed);
+}
+
+bool FlowField::wouldDisconnect(sf::Vector2i tile, const std::vector<sf::Vector2i>& sources) const
+{
+	// Nothing leads through a tile that is already cut off from the goal
+	if (!isInside(tile) || isBlocked[getIndex(tile)] || distances[getIndex(tile)] == UNREACHABLE)
+		return false;
+
+	std::vector<int> region;
+	std::vector<int> newDistances;
+	findBlockedRegion(getIndex(tile), region, newDistances);
+
+	// Tiles outside the region keep their route, so only the ones inside need checking
+	bool isDisconnected = false;
+	for (sf::Vector2i source : sources)
+	{
+		if (!isInside(source))
+			continue;
+
+		int slot = regionSlots[getIndex(source)];
+		if (slot != -1 && newDistances[slot] == UNREACHABLE)
+		{
+			isDisconnected = true;
+			break;
+		}
+	}
+
+	releaseRegion(region);
+	return isDisconnected;
+}
+
+int FlowField::getDistance(sf::Vector2i tile) const
+{
+	if (!isInside(tile))
+		return UNREACHABLE;
+	return distances[getIndex(tile)];
+}
+
+sf::Vector2i FlowField::getNextTile(sf::Vector2i tile) const
+{
+	if (!isInside(tile))
+		return tile;
+
+	std::uint8_t direction = nextSteps[getIndex(tile)];
+	if (direction == NO_STEP)
+		return tile;
+	return { tile.x + OFFSETS_X[direction], tile.y + OFFSETS_Y[direction] };
+}
+
+void FlowField::findBlockedRegion(int blockedIndex, std::vector<int>& region, std::vector<int>& newDistances) const
+{
+	region.assign(1, blockedIndex);
+	regionSlots[blockedIndex] = 0;
+
+	// A tile joins the region once none of its neighbours one step closer to the goal is left
+	// outside of it. The region grows in order of distance, so by the time a tile is looked at,
+	// every closer tile that will join already has.
+	if (distances[blockedIndex] != UNREACHABLE)
+	{
+		for (std::size_t i = 0; i < region.size(); ++i)
+		{
+			const int current = region[i];
+			for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+			{
+				int neighbour = getNeighbour(current, direction);
+				if (neighbour == -1 || isBlocked[neighbour] || regionSlots[neighbour] != -1 ||
+					distances[neighbour] != distances[current] + 1)
+					continue;
+
+				bool isStillSupported = false;
+				for (int supportDirection = 0; supportDirection < DIRECTION_COUNT && !isStillSupported; ++supportDirection)
+				{
+					int support = getNeighbour(neighbour, supportDirection);
+					isStillSupported = support != -1 && regionSlots[support] == -1 && !isBlocked[support] &&
+						distances[support] == distances[neighbour] - 1;
+				}
+
+				if (!isStillSupported)
+				{
+					regionSlots[neighbour] = static_cast<int>(region.size());
+					region.push_back(neighbour);
+				}
+			}
+		}
+	}
+
+	// Refill the region from the tiles around it, which keep their distances. The blocked tile
+	// itself stays unreachable.
+	newDistances.assign(region.size(), UNREACHABLE);
+	using QueueEntry = std::pair<int, int>; // Distance, slot
+	std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+	for (std::size_t slot = 1; slot < region.size(); ++slot)
+	{
+		for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+		{
+			int neighbour = getNeighbour(region[slot], direction);
+			if (neighbour != -1 && regionSlots[neighbour] == -1 && !isBlocked[neighbour] && distances[neighbour] != UNREACHABLE)
+				newDistances[slot] = std::min(newDistances[slot], distances[neighbour] + 1);
+		}
+		if (newDistances[slot] != UNREACHABLE)
+			queue.push({ newDistances[slot], static_cast<int>(slot) });
+	}
+
+	while (!queue.empty())
+	{
+		auto [distance, slot] = queue.top();
+		queue.pop();
+		if (distance > newDistances[slot])
+			continue;
+
+		for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+		{
+			int neighbour = getNeighbour(region[slot], direction);
+			if (neighbour == -1)
+				continue;
+
+			int neighbourSlot = regionSlots[neighbour];
+			if (neighbourSlot > 0 && distance + 1 < newDistances[neighbourSlot])
+			{
+				newDistances[neighbourSlot] = distance + 1;
+				queue.push({ distance + 1, neighbourSlot });
+			}
+		}
+	}
+}
+
+void FlowField::releaseRegion(const std::vector<int>& region) const
+{
+	for (int index : region)
+		regionSlots[index] = -1;
+}
+
+void FlowField::updateNextSteps(const std::vector<int>& changed)
+{
+	for (int index : changed)
+	{
+		nextSteps[index] = findNextStep(index);
+		for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+		{
+			int neighbour = getNeighbour(index, direction);
+			if (neighbour != -1)
+				nextSteps[neighbour] = findNextStep(neighbour);
+		}
+	}
+}
+
+std::uint8_t FlowField::findNextStep(int index) const
+{
+	if (isBlocked[index] || distances[index] == UNREACHABLE || distances[index] == 0)
+		return NO_STEP;
+
+	for (int direction = 0; direction < DIRECTION_COUNT; ++direction)
+	{
+		int neighbour = getNeighbour(index, direction);
+		if (neighbour != -1 && !isBlocked[neighbour] && distances[neighbour] == distances[index] - 1)
+			return static_cast<std::uint8_t>(direction);
+	}
+	return NO_STEP;
+}
+
+int FlowField::getNeighbour(int index, int direction) const
+{
+	int col = index % cols + OFFSETS_X[direction];
+	int row = index / cols + OFFSETS_Y[direction];
+	if (col < 0 || col >= cols || row < 0 || row >= rows)
+		return -1;
+	return row * cols + col;
+}
@@ -0,0 +1,78 @@
+// ================================================================================================
+// File: FlowField.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// Description: Defines the FlowField class, which holds the distance in tiles from every tile of
+//              the grid to the goal tile, found by a breadth-first search over the open tiles,
+//              along with the neighbour each tile steps to on its way there. Enemies on maze
+//              levels steer by reading the next step of the tile they are heading for, so no enemy
+//              ever has to search for a route itself.
+//              Blocking or opening a tile only revisits the tiles whose distance changes: opening
+//              spreads the shorter distances out from it, while blocking collects the tiles whose
+//              every shortest route led through it and refills just those from around them.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "Tile.hpp"
+
+class FlowField
+{
+public:
+	FlowField();
+
+	// Searches the whole grid from the goal. Tower tiles are blocked, every other tile is open.
+	void build(int cols, int rows, const std::vector<Tile::Type>& tiles, sf::Vector2i goal);
+
+	void block(sf::Vector2i tile);
+	void unblock(sf::Vector2i tile);
+
+	// Returns true if blocking the tile would leave any of the given tiles that have a route to
+	// the goal without one, including when the tile is one of them. The field is left unchanged.
+	bool wouldDisconnect(sf::Vector2i tile, const std::vector<sf::Vector2i>& sources) const;
+
+	// Number of steps to the goal; UNREACHABLE for blocked tiles, tiles cut off from the goal and
+	// tiles outside the grid
+	int getDistance(sf::Vector2i tile) const;
+	// The open neighbour one step closer to the goal, or the tile itself if it is the goal or
+	// has no route to it
+	sf::Vector2i getNextTile(sf::Vector2i tile) const;
+	inline sf::Vector2i getGoal() const { return goal; }
+
+	static const int UNREACHABLE;
+
+private:
+	// Fills region with the tiles whose every shortest route leads through the given open tile,
+	// starting with the tile itself, and newDistances with the distance each of them has once it
+	// is blocked. Leaves regionSlots set for the region; releaseRegion() clears them again.
+	void findBlockedRegion(int blockedIndex, std::vector<int>& region, std::vector<int>& newDistances) const;
+	void releaseRegion(const std::vector<int>& region) const;
+
+	// Recomputes the next step of every changed tile and of its neighbours
+	void updateNextSteps(const std::vector<int>& changed);
+	std::uint8_t findNextStep(int index) const;
+
+	// Index of the neighbour in the given direction, or -1 if it is outside the grid
+	int getNeighbour(int index, int direction) const;
+	inline bool isInside(sf::Vector2i tile) const { return tile.x >= 0 && tile.x < cols && tile.y >= 0 && tile.y < rows; }
+	inline int getIndex(sf::Vector2i tile) const { return tile.y * cols + tile.x; }
+
+	int cols, rows;
+	sf::Vector2i goal;
+	std::vector<int> distances;          // Row-major, like the grid's tiles
+	std::vector<std::uint8_t> nextSteps; // Direction towards the goal, or NO_STEP
+	std::vector<std::uint8_t> isBlocked;
+	mutable std::vector<int> regionSlots; // Scratch for findBlockedRegion(); -1 outside of a region
+
+	static constexpr int DIRECTION_COUNT = 4;
+	static constexpr std::uint8_t NO_STEP = DIRECTION_COUNT;
+	// Right comes first, so ties are broken towards the exit
+	static const int OFFSETS_X[DIRECTION_COUNT];
+	static const int OFFSETS_Y[DIRECTION_COUNT];
+};
@@ -7,43 +7,68 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <cmath>
 #include <iostream>
+#include <map>
 #include "Game.hpp"
 #include "Utility.hpp"
-#include "../entities/BulletTower.hpp"
-#include "../entities/SplashTower.hpp"
-#include "../entities/SlowTower.hpp"
+#include "AssetManifest.hpp"
 
 const bool Game::IS_DEBUG_MODE_ON = false;
 
-Game::Game() :
+namespace
+{
+	sf::ContextSettings getContextSettings(unsigned antiAliasingLevel)
+	{
+		sf::ContextSettings settings;
+		settings.antiAliasingLevel = antiAliasingLevel;
+		return settings;
+	}
+
+	bool isMouseButtonReleased(sf::Mouse::Button button)
+	{
+		static std::map<sf::Mouse::Button, bool> buttonStates;
+		if (buttonStates.find(button) == buttonStates.end())
+			buttonStates[button] = false;
+		bool isPressedNow = sf::Mouse::isButtonPressed(button);
+		bool wasPressedLastFrame = buttonStates[button];
+		buttonStates[button] = isPressedNow;
+		return !isPressedNow && wasPressedLastFrame;
+	}
+
+	bool isKeyReleased(sf::Keyboard::Key key)
+	{
+		static std::map<sf::Keyboard::Key, bool> keyStates;
+		if (keyStates.find(key) == keyStates.end())
+			keyStates[key] = false;
+		bool isPressedNow = sf::Keyboard::isKeyPressed(key);
+		bool wasPressedLastFrame = keyStates[key];
+		keyStates[key] = isPressedNow;
+		return !isPressedNow && wasPressedLastFrame;
+	}
+}
+
+Game::Game(const std::string& executablePath) :
 	isRunning(true),
 	antiAliasingLevel(8),
 	isVSyncEnabled(true),
 	gameState(GameState::MainMenu),
-	lives(STARTING_LIVES),
-	gold(std::make_shared<int>(STARTING_GOLD)),
-	grid(10, 8),
-	timeBetweenWaves(10.f),
-	timeSinceLastWaveEnded(10.f),
-	timeBetweenEnemies(0.7f),
-	timeSinceLastEnemySpawned(0.f),
-	wave(0),
-	enemiesPerWave(5),
-	enemiesSpawnedThisWave(0),
-	waitingForFirstEnemyInWave(false),
-	font("assets/fonts/BRLNSR.TTF"),
-	ui(font, WINDOW_SIZE, gold),
+	simulation(10, 8),
+	isReplaying(false),
+	maxUpdatesPerFrame(5),
+	cameraZoom(1.f),
+	assets(AssetManifest::getArchivePath(executablePath)),
+	areAssetsReady(false),
+	window(sf::VideoMode(WINDOW_SIZE), WINDOW_TITLE, sf::Style::Close, sf::State::Windowed, getContextSettings(antiAliasingLevel)),
+	font(waitForFont()),
+	ui(font, WINDOW_SIZE, simulation.getGoldPointer()),
 	titleText(font, "Tower Defense", 128U),
-	startText(font, "Press ENTER to start", 64U),
+	startText(font, "Loading...", 64U),
 	authorText(font, "Luka Vukorepa 2025", 32U),
 	gameOverText(font, "Game Over!", 104U),
 	gameOverWaveText(font, "Reached wave: ", 64U),
 	restartText(font, "Press ENTER to return to Main Menu", 64U)
 {
-	auto settings = sf::ContextSettings();
-	settings.antiAliasingLevel = antiAliasingLevel;
-	window.create(sf::VideoMode(WINDOW_SIZE), WINDOW_TITLE, sf::Style::Close, sf::State::Windowed, settings);
 	window.setVerticalSyncEnabled(isVSyncEnabled);
 
 	titleText.setFillColor(sf::Color(255, 255, 255));
@@ -82,31 +107,174 @@ Game::Game() :
 	restartText.setOrigin({ restartText.getGlobalBounds().size.x / 2.f, restartText.getGlobalBounds().size.y / 2.f });
 	restartText.setPosition(startText.getPosition());
 
-	soundManager.loadSounds();
+	simulation.setProfiler(&profiler);
+	resetCamera();
+
+	if (!loadBalance(AssetManifest::getBalancePath()))
+		std::cerr << "Warning: Playing with the built-in balance." << std::endl;
+}
+
+void Game::setMapSize(sf::Vector2i mapSize)
+{
+	simulation.reset(simulation.getSeed(), mapSize);
+	resetCamera();
+}
+
+void Game::setPathingMode(Grid::PathingMode pathingMode)
+{
+	simulation.setPathingMode(pathingMode);
+	simulation.reset(simulation.getSeed(), simulation.getMapSize());
+}
+
+bool Game::loadBalance(const std::string& filename)
+{
+	auto balance = std::make_shared<Balance>();
+	if (!balance->loadFromFile(filename))
+		return false;
+
+	balanceFilename = filename;
+	std::error_code error;
+	balanceWriteTime = std::filesystem::last_write_time(filename, error);
+
+	simulation.setBalance(balance);
+	simulation.reset(simulation.getSeed());
+	ui.setBalance(*balance);
+	return true;
+}
+
+void Game::reloadBalanceIfChanged()
+{
+	if (balanceFilename.empty() || balanceCheckClock.getElapsedTime().asSeconds() < BALANCE_CHECK_INTERVAL)
+		return;
+	balanceCheckClock.restart();
+
+	std::error_code error;
+	std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(balanceFilename, error);
+	if (error || writeTime == balanceWriteTime)
+		return;
+	balanceWriteTime = writeTime;
+
+	auto balance = std::make_shared<Balance>();
+	if (!balance->loadFromFile(balanceFilename))
+	{
+		std::cerr << "Warning: Keeping the previous balance." << std::endl;
+		return;
+	}
+
+	// A replay only plays back the same game with the balance it was recorded with, so it keeps
+	// its balance until it ends
+	if (gameState == GameState::Gameplay && !isReplaying)
+		simulation.reloadBalance(balance);
+	else
+	{
+		simulation.setBalance(balance);
+		if (gameState != GameState::Gameplay)
+			simulation.reset(simulation.getSeed());
+	}
+	ui.setBalance(*balance);
+	std::cout << "Reloaded " << balanceFilename << std::endl;
+}
+
+const sf::Font& Game::waitForFont()
+{
+	window.clear(sf::Color(110, 115, 120));
+	window.display();
+	return assets.waitForFont();
+}
+
+void Game::onAssetsReady()
+{
+	assets.installSounds(soundManager);
+	areAssetsReady = true;
+	std::cout << assets.getTimingReport() << std::endl;
+
+	startText.setString("Press ENTER to start");
+	startText.setOrigin({ startText.getGlobalBounds().size.x / 2.f, startText.getGlobalBounds().size.y / 2.f });
+}
+
+bool Game::loadReplay(const std::string& filename)
+{
+	isReplaying = replay.loadFromFile(filename);
+	return isReplaying;
 }
 
 int Game::run()
 {
-	const float FIXED_TIME_STEP = 1.f / 60.f; // Fixed time step per update
+	const float FIXED_TIME_STEP = Simulation::FIXED_TIME_STEP; // Fixed time step per update
 	sf::Clock clock;						  // Clock to measure time
 	float timeSinceLastUpdate = 0.f;		  // Time accumulator for fixed timestep
 	float interpolationFactor = 0.f;		  // Interpolation factor for rendering
 
 	while (isRunning)
 	{
-		timeSinceLastUpdate += clock.restart().asSeconds();
+		int fixedUpdates = 0;
+		{
+			Profiler::ScopedTimer frameTimer(&profiler, Profiler::Section::Frame);
 
-		processInput();
+			float frameTime = clock.restart().asSeconds();
+			timeSinceLastUpdate += frameTime;
 
-		while (timeSinceLastUpdate >= FIXED_TIME_STEP)
-		{
-			update(FIXED_TIME_STEP);
-			timeSinceLastUpdate -= FIXED_TIME_STEP;
+			{
+				Profiler::ScopedTimer timer(&profiler, Profiler::Section::ProcessInput);
+				processInput();
+				updateCamera(frameTime);
+			}
+
+			{
+				Profiler::ScopedTimer timer(&profiler, Profiler::Section::Update);
+
+				// Effects are stepped along with each fixed update. A frame that hits the cap steps them
+				// once with the combined time instead, since it is already behind.
+				const bool isOverCap = static_cast<int>(timeSinceLastUpdate / FIXED_TIME_STEP) > maxUpdatesPerFrame;
+				while (timeSinceLastUpdate >= FIXED_TIME_STEP && fixedUpdates < maxUpdatesPerFrame)
+				{
+					update(FIXED_TIME_STEP);
+					if (!isOverCap)
+						updateEffects(FIXED_TIME_STEP);
+					timeSinceLastUpdate -= FIXED_TIME_STEP;
+					fixedUpdates++;
+				}
+				if (isOverCap)
+					updateEffects(fixedUpdates * FIXED_TIME_STEP);
+
+				// Past the cap the game slows down instead of trying to catch up, which would make the
+				// next frame even longer. Whole steps are dropped; the remainder is kept for interpolation.
+				if (timeSinceLastUpdate >= FIXED_TIME_STEP)
+				{
+					float droppedTime = std::floor(timeSinceLastUpdate / FIXED_TIME_STEP) * FIXED_TIME_STEP;
+					timeSinceLastUpdate -= droppedTime;
+					profiler.addDroppedTime(droppedTime);
+				}
+			}
+
+			// Sounds queued by this frame's updates and input
+			soundManager.playQueuedSounds();
+
+			interpolationFactor = timeSinceLastUpdate / FIXED_TIME_STEP;
+			render(interpolationFactor);
+			assets.markFirstFrame();
+
+			if (!areAssetsReady && assets.isFinished())
+				onAssetsReady();
+
+#ifndef NDEBUG
+			reloadBalanceIfChanged();
+#endif
 		}
+		profiler.endFrame(fixedUpdates);
 
-		interpolationFactor = timeSinceLastUpdate / FIXED_TIME_STEP;
-		render(interpolationFactor);
+		// Rebuilding the text every frame would show up in the numbers it displays
+		if (ui.isProfilerOverlayVisible() && profiler.getFrameCount() % 15 == 0)
+			ui.updateProfilerOverlay(profiler);
 	}
+
+	if (!profileCsvFilename.empty())
+		profiler.writeCsv(profileCsvFilename);
+
+	// Keep the game that was in progress when the window was closed
+	if (gameState == GameState::Gameplay && !isReplaying && !recordFilename.empty())
+		replay.saveToFile(recordFilename);
+
 	return 0;
 }
 
@@ -118,17 +286,27 @@ void Game::processInput()
 		{
 			isRunning = false;
 		}
+		else if (const auto* scrolled = event->getIf<sf::Event::MouseWheelScrolled>())
+		{
+			if (gameState == GameState::Gameplay)
+				zoomCamera(std::pow(CAMERA_ZOOM_STEP, -scrolled->delta), scrolled->position);
+		}
 	}
-	if (Utility::isKeyReleased(sf::Keyboard::Key::Escape))
+	if (isKeyReleased(sf::Keyboard::Key::Escape))
 	{
 		isRunning = false;
 	}
+	if (isKeyReleased(sf::Keyboard::Key::F3))
+	{
+		ui.setProfilerOverlayVisible(!ui.isProfilerOverlayVisible());
+		ui.updateProfilerOverlay(profiler);
+	}
 
 	switch (gameState)
 	{
 	case GameState::MainMenu:
 	{
-		if (Utility::isKeyReleased(sf::Keyboard::Key::Enter))
+		if (areAssetsReady && isKeyReleased(sf::Keyboard::Key::Enter))
 		{
 			switchGameState(GameState::Gameplay);
 		}
@@ -136,43 +314,58 @@ void Game::processInput()
 	}
 	case GameState::Gameplay:
 	{
-		sf::Vector2f mousePosition = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-		sf::Vector2i hoveredTile = Utility::pixelToTilePosition(mousePosition);
+		// The UI is in screen space, the map is seen through the camera
+		sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
+		sf::Vector2f mousePosition = window.mapPixelToCoords(mousePixel, window.getDefaultView());
+		sf::Vector2i hoveredTile = Utility::pixelToTilePosition(window.mapPixelToCoords(mousePixel, camera));
 
-		bool isLeftReleased = Utility::isMouseButtonReleased(sf::Mouse::Button::Left);
-		bool isRightReleased = Utility::isMouseButtonReleased(sf::Mouse::Button::Right);
+		bool isLeftReleased = isMouseButtonReleased(sf::Mouse::Button::Left);
+		bool isRightReleased = isMouseButtonReleased(sf::Mouse::Button::Right);
 
 		ui.processInput(mousePosition, isLeftReleased);
 
+		if (ui.getRequestedTowerAction() != TowerInfoMenu::Action::None)
+		{
+			Simulation::Command command{ Simulation::Command::Type::SellTower, ui.getRequestedTowerActionTile() };
+			if (ui.getRequestedTowerAction() == TowerInfoMenu::Action::Upgrade)
+				command.type = Simulation::Command::Type::UpgradeTower;
+			else if (ui.getRequestedTowerAction() == TowerInfoMenu::Action::CycleTargeting)
+			{
+				command.type = Simulation::Command::Type::SetTargeting;
+				command.targetingPolicy = ui.getRequestedTargetingPolicy();
+			}
+			if (!isReplaying)
+				simulation.submitCommand(command);
+			ui.clearRequestedTowerAction();
+		}
+
 		if (isRightReleased)
 		{
-			auto towerAtTile = std::find_if(towers.begin(), towers.end(),
-				[hoveredTile](std::shared_ptr<Tower> tower)
-				{
-					return tower->getTilePosition() == hoveredTile;
-				});
+			std::shared_ptr<Tower> towerAtTile = simulation.getTowerAt(hoveredTile);
 
 			if (!ui.isAnyMenuHoveredOver())
 			{
 				// If a tower is found at the hovered tile
-				if (towerAtTile != towers.end())
+				if (towerAtTile)
 				{
 					ui.dismissAllMenus();
-					grid.deselectAllTiles();
+					simulation.getGrid().deselectAllTiles();
 					deselectAllTowers();
-					ui.showTowerInfoMenu(*towerAtTile, WINDOW_SIZE);
-					(*towerAtTile)->isSelected = true;
+					sf::Vector2f screenPosition(window.mapCoordsToPixel(towerAtTile->getPixelPosition(), camera));
+					ui.showTowerInfoMenu(towerAtTile, screenPosition, WINDOW_SIZE);
+					towerAtTile->isSelected = true;
 				}
 				// If no tower is found at the hovered tile
 				else
 				{
 					ui.dismissAllMenus();
-					grid.deselectAllTiles();
+					simulation.getGrid().deselectAllTiles();
 					deselectAllTowers();
-					if (grid.getTileType(hoveredTile) == Tile::Type::Buildable)
+					if (simulation.canPlaceTower(hoveredTile))
 					{
-						ui.showTowerBuildMenu(hoveredTile, WINDOW_SIZE);
-						grid.selectTile(hoveredTile);
+						sf::Vector2f screenPosition(window.mapCoordsToPixel(Utility::tileToPixelPosition(hoveredTile), camera));
+						ui.showTowerBuildMenu(hoveredTile, screenPosition, WINDOW_SIZE);
+						simulation.getGrid().selectTile(hoveredTile);
 					}
 				}
 			}
@@ -183,7 +376,7 @@ void Game::processInput()
 			if (!ui.isAnyMenuHoveredOver())
 			{
 				ui.dismissAllMenus();
-				grid.deselectAllTiles();
+				simulation.getGrid().deselectAllTiles();
 				deselectAllTowers();
 			}
 		}
@@ -192,7 +385,7 @@ void Game::processInput()
 	}
 	case GameState::GameOver:
 	{
-		if (Utility::isKeyReleased(sf::Keyboard::Key::Enter))
+		if (isKeyReleased(sf::Keyboard::Key::Enter))
 		{
 			switchGameState(GameState::MainMenu);
 		}
@@ -201,6 +394,29 @@ void Game::processInput()
 	}
 }
 
+void Game::updateCamera(float frameTime)
+{
+	if (gameState != GameState::Gameplay || !window.hasFocus())
+		return;
+
+	sf::Vector2f direction;
+	if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left))
+		direction.x -= 1.f;
+	if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right))
+		direction.x += 1.f;
+	if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up))
+		direction.y -= 1.f;
+	if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down))
+		direction.y += 1.f;
+
+	if (direction == sf::Vector2f())
+		return;
+
+	// Panning covers the same share of the screen per second at any zoom
+	camera.move(Utility::normalize(direction) * CAMERA_PAN_SPEED * cameraZoom * frameTime);
+	clampCamera();
+}
+
 void Game::update(float fixedTimeStep)
 {
 	switch (gameState)
@@ -211,97 +427,23 @@ void Game::update(float fixedTimeStep)
 	}
 	case GameState::Gameplay:
 	{
-		static int updateCount = 0;
+		// A replay takes the place of the player
+		if (isReplaying)
+			replay.submitDueCommands(simulation);
 
-		updateWave(fixedTimeStep);		
-
-		for (auto& enemy : enemies)
-		{
-			enemy.update(fixedTimeStep, grid);
-
-			if (enemy.hasReachedEnd())
-			{
-				lives--;
-				soundManager.playSound(SoundManager::SoundID::LIFE_LOST);
-			}
-			if (enemy.isDead())
-			{
-				*gold += enemy.getWorth();
-			}
-		}
-
-		for (auto& tower : towers)
-		{
-			tower->update(fixedTimeStep, enemies, soundManager);
+		simulation.update(fixedTimeStep);
+		handleSimulationEvents();
 
-			if (tower->isMarkedForUpgrade())
-			{
-				if (tower->tryUpgrade(*gold))
-				{
-					*gold -= tower->getAttributes().at(tower->getLevel()).buyCost;
-					soundManager.playSound(SoundManager::SoundID::TOWER_UPGRADE);
-				}
-			}
-			if (tower->isMarkedForSale())
-			{
-				*gold += tower->getAttributes().at(tower->getLevel()).sellCost;
-				soundManager.playSound(SoundManager::SoundID::BUTTON_CLICK);
-			}
-		}
-
-		// Remove towers that are sold
-		towers.erase(std::remove_if(towers.begin(), towers.end(),
-			[](const std::shared_ptr<Tower>& tower)
-			{
-				return tower->isMarkedForSale();
-			}),
-			towers.end()
-		);
-
-		// Remove enemies that have reached the end or are dead
-		enemies.erase(std::remove_if(enemies.begin(), enemies.end(),
-			[](const Enemy& enemy)
-			{
-				return enemy.hasReachedEnd() || enemy.isDead();
-			}),
-			enemies.end()
-		);
-
-		// Tower placement logic
+		// Tower placement logic; the tower is built at the start of the next update
 		if (ui.getRequestedTowerType() != TowerRegistry::Type::Count && ui.getSelectedTile() != sf::Vector2i(-1, -1))
 		{
-			switch (ui.getRequestedTowerType())
-			{
-			case TowerRegistry::Type::Bullet:
-			{
-				towers.push_back(std::make_shared<BulletTower>(ui.getSelectedTile()));
-				break;
-			}
-			case TowerRegistry::Type::Splash:
-			{
-				towers.push_back(std::make_shared<SplashTower>(ui.getSelectedTile()));
-				break;
-			}
-			case TowerRegistry::Type::Slow:
-			{
-				towers.push_back(std::make_shared<SlowTower>(ui.getSelectedTile()));
-				break;
-			}
-			}
-			*gold -= towers.back()->getAttributes().at(0).buyCost;
-			soundManager.playSound(SoundManager::SoundID::BUTTON_CLICK);
+			if (!isReplaying)
+				simulation.submitCommand({ Simulation::Command::Type::PlaceTower, ui.getSelectedTile(), ui.getRequestedTowerType() });
 			ui.dismissAllMenus();
-			grid.deselectAllTiles();
-		}
-
-		ui.update(fixedTimeStep, lives, *gold, wave);
-
-		if (updateCount % 60 == 0) {
-			soundManager.cleanupSounds();
+			simulation.getGrid().deselectAllTiles();
 		}
-		updateCount++;
 
-		if (lives <= 0)
+		if (simulation.isGameOver())
 			switchGameState(GameState::GameOver);
 
 		break;
@@ -313,6 +455,27 @@ void Game::update(float fixedTimeStep)
 	}
 }
 
+void Game::handleSimulationEvents()
+{
+	const SimulationEvents& events = simulation.getEvents();
+	for (const SimulationEvents::Sound& sound : events.getSounds())
+		soundManager.queueSound(sound.soundID, sound.pitchVariancePercentage);
+	simulationRenderer.handleEvents(events);
+}
+
+void Game::updateEffects(float deltaTime)
+{
+	if (gameState != GameState::Gameplay)
+		return;
+
+	Profiler::ScopedTimer effectsTimer(&profiler, Profiler::Section::UpdateEffects);
+	simulation.updateEffects(deltaTime);
+	simulationRenderer.updateEffects(deltaTime);
+
+	Profiler::ScopedTimer timer(&profiler, Profiler::Section::UIUpdate);
+	ui.update(deltaTime, simulation.getLives(), simulation.getGold(), simulation.getWave());
+}
+
 void Game::render(float interpolationFactor)
 {
 	window.clear(sf::Color(110, 115, 120));
@@ -326,114 +489,144 @@ void Game::render(float interpolationFactor)
 		break;
 
 	case GameState::Gameplay:
-		grid.render(interpolationFactor, window);
-
-		for (auto& tower : towers)
-			tower->render(interpolationFactor, window);
-
-		for (auto& enemy : enemies)
-			enemy.render(interpolationFactor, window);
-
-		ui.render(interpolationFactor, window);
-
-		break;
-
-	case GameState::GameOver:
-		window.draw(gameOverText);
-		window.draw(gameOverWaveText);
-		window.draw(restartText);
-		break;
-	}
-
-	window.display();
-}
-
-void Game::updateWave(float fixedTimeStep)
-{
-	//static int healthModifier = 0;
-
-	timeSinceLastEnemySpawned += fixedTimeStep;
-
-	if (timeSinceLastWaveEnded >= timeBetweenWaves)
 	{
-		if (enemiesSpawnedThisWave == 0 && !waitingForFirstEnemyInWave)
+		window.setView(camera);
+		const sf::FloatRect visibleArea = getCameraRect();
 		{
-			soundManager.playSound(SoundManager::SoundID::NEW_WAVE);
-
-			wave++;
-			timeBetweenEnemies -= 0.01f;
-			enemiesPerWave++;
-
-			/*if (wave % 2 == 0)
+			Profiler::ScopedTimer timer(&profiler, Profiler::Section::RenderGrid);
+			simulationRenderer.renderGrid(simulation.getGrid(), window);
+		}
+		{
+			Profiler::ScopedTimer timer(&profiler, Profiler::Section::RenderTowers);
+			for (auto& tower : simulation.getTowers())
 			{
-				healthModifier++;
-			}*/
-			waitingForFirstEnemyInWave = true;
+				// The margin keeps the range circle of a tower just off screen visible
+				sf::Vector2f position = tower->getPixelPosition();
+				float margin = tower->getStats().range + Grid::TILE_SIZE;
+				if (position.x + margin < visibleArea.position.x || position.x - margin > visibleArea.position.x + visibleArea.size.x ||
+					position.y + margin < visibleArea.position.y || position.y - margin > visibleArea.position.y + visibleArea.size.y)
+					continue;
+				simulationRenderer.renderTower(*tower, window);
+			}
 		}
-
-		if (timeSinceLastEnemySpawned >= timeBetweenEnemies && enemiesSpawnedThisWave < enemiesPerWave)
 		{
-			waitingForFirstEnemyInWave = false;
-			timeSinceLastEnemySpawned = 0.f;
-			enemiesSpawnedThisWave++;
-
-			enemies.emplace_back(grid.getStartTile(), Enemy::BASE_SPEED + wave * 0.15f, Enemy::BASE_HEALTH + wave / 3.f);
+			// Everything round is collected and drawn in one batch on top of the towers
+			Profiler::ScopedTimer timer(&profiler, Profiler::Section::RenderBatch);
+			batch.clear();
+			batch.setVisibleArea(visibleArea);
+			simulationRenderer.renderEntities(simulation, interpolationFactor, batch);
+			batch.draw(window);
 		}
-
-		if (enemiesSpawnedThisWave >= enemiesPerWave)
+		window.setView(window.getDefaultView());
 		{
-			timeSinceLastWaveEnded = 0.f;
-			enemiesSpawnedThisWave = 0;
+			Profiler::ScopedTimer timer(&profiler, Profiler::Section::RenderUI);
+			ui.render(interpolationFactor, window);
 		}
+		break;
 	}
-	else
-	{
-		timeSinceLastWaveEnded += fixedTimeStep;
+
+	case GameState::GameOver:
+		window.draw(gameOverText);
+		window.draw(gameOverWaveText);
+		window.draw(restartText);
+		break;
 	}
+
+	Profiler::ScopedTimer timer(&profiler, Profiler::Section::Display);
+	window.display();
 }
 
 void Game::deselectAllTowers()
 {
-	for (auto& tower : towers)
+	for (auto& tower : simulation.getTowers())
 		tower->isSelected = false;
 }
 
 void Game::resetGame()
 {
 	ui.dismissAllMenus();
-	grid.deselectAllTiles();
+	simulation.getGrid().deselectAllTiles();
 	deselectAllTowers();
 
-	towers.clear();
-	enemies.clear();
+	simulation.reset();
+	simulationRenderer.clear();
+	resetCamera();
+}
 
-	timeBetweenWaves = 10.f;
-	timeSinceLastWaveEnded = 10.f;
-	timeBetweenEnemies = 0.7f;
-	timeSinceLastEnemySpawned = 0.f;
-	wave = 0;
-	enemiesPerWave = 5;
-	enemiesSpawnedThisWave = 0;
-	waitingForFirstEnemyInWave = false;
+void Game::resetCamera()
+{
+	cameraZoom = 1.f;
+	camera.setSize(sf::Vector2f(WINDOW_SIZE));
+	camera.setCenter(sf::Vector2f(WINDOW_SIZE) / 2.f);
+	clampCamera();
+}
 
-	lives = STARTING_LIVES;
-	*gold = STARTING_GOLD;
+void Game::zoomCamera(float factor, sf::Vector2i pixelPosition)
+{
+	sf::Vector2f bounds = getCameraBounds();
+	float maxZoom = std::max(bounds.x / WINDOW_SIZE.x, bounds.y / WINDOW_SIZE.y);
+	float newZoom = std::clamp(cameraZoom * factor, MIN_CAMERA_ZOOM, maxZoom);
+	if (newZoom == cameraZoom)
+		return;
+
+	// Zoom towards the cursor: the point under it stays in place
+	sf::Vector2f anchorBefore = window.mapPixelToCoords(pixelPosition, camera);
+	cameraZoom = newZoom;
+	camera.setSize(sf::Vector2f(WINDOW_SIZE) * cameraZoom);
+	camera.move(anchorBefore - window.mapPixelToCoords(pixelPosition, camera));
+	clampCamera();
+}
+
+void Game::clampCamera()
+{
+	sf::Vector2f bounds = getCameraBounds();
+	sf::Vector2f halfSize = camera.getSize() / 2.f;
+	sf::Vector2f center = camera.getCenter();
 
-	grid.generateNewRandomLevel(10, 8);
+	center.x = halfSize.x * 2.f >= bounds.x ? bounds.x / 2.f : std::clamp(center.x, halfSize.x, bounds.x - halfSize.x);
+	center.y = halfSize.y * 2.f >= bounds.y ? bounds.y / 2.f : std::clamp(center.y, halfSize.y, bounds.y - halfSize.y);
+	camera.setCenter(center);
+}
+
+sf::Vector2f Game::getCameraBounds() const
+{
+	sf::Vector2f mapSize = simulation.getGrid().getPixelSize();
+	return { std::max(mapSize.x, static_cast<float>(WINDOW_SIZE.x)), std::max(mapSize.y, static_cast<float>(WINDOW_SIZE.y)) };
+}
+
+sf::FloatRect Game::getCameraRect() const
+{
+	return { camera.getCenter() - camera.getSize() / 2.f, camera.getSize() };
 }
 
 void Game::switchGameState(GameState newGameState)
 {
-	soundManager.playSound(SoundManager::SoundID::BUTTON_CLICK);
+	soundManager.queueSound(SoundManager::SoundID::BUTTON_CLICK);
 
 	switch (gameState)
 	{
 	case GameState::MainMenu:
+		// Start recording, or restart the replay on the level it was recorded on
+		if (isReplaying)
+		{
+			simulation.setPathingMode(replay.getPathingMode());
+			simulation.reset(replay.getSeed(), replay.getMapSize());
+			replay.rewind();
+			resetCamera();
+		}
+		else
+		{
+			replay = Replay(simulation.getSeed(), simulation.getMapSize(), simulation.getPathingMode());
+			simulation.setRecorder(&replay);
+		}
 		gameState = newGameState;
 		break;
 
 	case GameState::Gameplay:
-		gameOverWaveText.setString("Reached wave: " + std::to_string(wave));
+		gameOverWaveText.setString("Reached wave: " + std::to_string(simulation.getWave()));
+		simulation.setRecorder(nullptr);
+		if (!isReplaying && !recordFilename.empty())
+			replay.saveToFile(recordFilename);
 		resetGame();
 		gameState = newGameState;
 		break;
@@ -11,24 +11,50 @@
 
 #pragma once
 
+#include <algorithm>
+#include <filesystem>
 #include <SFML/Graphics/RenderWindow.hpp>
-#include "Grid.hpp"
-#include "../entities/Enemy.hpp"
-#include "../entities/Tower.hpp"
+#include "Simulation.hpp"
+#include "Replay.hpp"
+#include "Profiler.hpp"
+#include "AssetLoader.hpp"
+#include "../render/BatchRenderer.hpp"
+#include "../render/SimulationRenderer.hpp"
 #include "../ui/UIManager.hpp"
 #include "../audio/SoundManager.hpp"
 
 class Game
 {
 public:
-	Game();
+	// The executable's path locates the asset archive next to it
+	Game(const std::string& executablePath);
 	int run();
 
+	// Saves the commands of every game played to the given file, overwriting the previous game.
+	inline void setRecordFilename(const std::string& filename) { recordFilename = filename; }
+	// Plays the replay instead of taking player commands. Returns false if it could not be loaded.
+	bool loadReplay(const std::string& filename);
+	// Writes the profiler stats to the given CSV file when the game exits.
+	inline void setProfileCsvFilename(const std::string& filename) { profileCsvFilename = filename; }
+	// Caps the fixed updates run per frame; simulation time beyond the cap is dropped.
+	inline void setMaxUpdatesPerFrame(int maxUpdates) { maxUpdatesPerFrame = std::max(1, maxUpdates); }
+	// Generates levels of the given size in tiles. A loaded replay uses the size it was recorded with.
+	void setMapSize(sf::Vector2i mapSize);
+	// Generates lane or maze levels. A loaded replay uses the mode it was recorded with.
+	void setPathingMode(Grid::PathingMode pathingMode);
+	// Replaces the balance with the definitions in the given file, starting a new game with it.
+	// Returns false and keeps the current balance if the file could not be loaded.
+	bool loadBalance(const std::string& filename);
+
 	static const bool IS_DEBUG_MODE_ON;
 
 private:
 	void processInput();
+	void updateCamera(float frameTime);
 	void update(float fixedTimeStep);
+	// Hands the sounds and enemy deaths of the last fixed update to the sound manager and the renderer
+	void handleSimulationEvents();
+	void updateEffects(float deltaTime);
 	void render(float interpolationFactor);
 
 	enum class GameState
@@ -38,43 +64,63 @@ private:
 		GameOver
 	};
 	void switchGameState(GameState newGameState);
+	// Shows an empty frame so the window appears right away, then blocks until the font has loaded
+	const sf::Font& waitForFont();
+	void onAssetsReady();
 
-	void updateWave(float fixedTimeStep);
 	void deselectAllTowers();
 	void resetGame();
 
+	// Reloads the balance file if it has been saved since it was last loaded. A game in progress
+	// carries on with the new values; otherwise the next game starts with them.
+	void reloadBalanceIfChanged();
+
+	void resetCamera();
+	void zoomCamera(float factor, sf::Vector2i pixelPosition);
+	// Keeps the camera's center inside the map, or centered on it when zoomed out past it
+	void clampCamera();
+	// The area the camera may show; at least the window's size, so small maps keep the default layout
+	sf::Vector2f getCameraBounds() const;
+	sf::FloatRect getCameraRect() const;
+
 	// Loop and state management
 	GameState gameState;
 	bool isRunning;
+	int maxUpdatesPerFrame;
+
+	// Starts loading as soon as it is constructed, so it is declared before everything using the assets
+	// and before the window, which takes a while to open
+	AssetLoader assets;
+	bool areAssetsReady; // Gameplay can only start once every asset has loaded
 
 	// Window
-	sf::RenderWindow window;
 	const sf::Vector2u WINDOW_SIZE = { 1200, 1200 };
 	const sf::String WINDOW_TITLE = "Project 2 - Tower Defense Game";
 	unsigned antiAliasingLevel;
 	bool isVSyncEnabled;
+	sf::RenderWindow window;
+
+	// Camera over the map
+	sf::View camera;
+	float cameraZoom; // 1 shows the map at its native scale; larger values zoom out
+	const float MIN_CAMERA_ZOOM = 0.5f;
+	const float CAMERA_PAN_SPEED = 1200.f; // Pixels per second at a zoom of 1
+	const float CAMERA_ZOOM_STEP = 1.1f;   // Zoom factor per mouse wheel notch
 
 	// Gameplay data
-	const int STARTING_LIVES = 5;
-	const int STARTING_GOLD = 100;
-	int lives;
-	std::shared_ptr<int> gold;
-
-	Grid grid;
-
-	std::vector<std::shared_ptr<Tower>> towers;
-
-	// Enemies
-	std::vector<Enemy> enemies;
-	float timeBetweenWaves;
-	float timeSinceLastWaveEnded;
-	float timeBetweenEnemies;
-	float timeSinceLastEnemySpawned;
-	int wave;
-	int enemiesPerWave;
-	int enemiesSpawnedThisWave;
-	bool waitingForFirstEnemyInWave;
+	Simulation simulation;
+	Replay replay;
+	std::string recordFilename;
+	bool isReplaying;
 
+	// Balance definitions, watched for changes in debug builds
+	std::string balanceFilename;
+	std::filesystem::file_time_type balanceWriteTime;
+	sf::Clock balanceCheckClock;
+	const float BALANCE_CHECK_INTERVAL = 0.5f; // Seconds between checks of the file's write time
+
+	SimulationRenderer simulationRenderer;
+	BatchRenderer batch;
 	sf::Font font;
 	UIManager ui;
 	sf::Text titleText;
@@ -85,4 +131,8 @@ private:
 	sf::Text restartText;
 
 	SoundManager soundManager;
+
+	// Instrumentation; the overlay is toggled with F3
+	Profiler profiler;
+	std::string profileCsvFilename;
 };
\ No newline at end of file
@@ -0,0 +1,124 @@
+// ================================================================================================
+// File: Geometry.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include "Geometry.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define GEOMETRY_USE_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace
+{
+	// The plain path, used for the points left over after the last full group of four and on
+	// targets without SSE2. Multiplies and adds in the same order as the vector path.
+	inline float getDistanceSquared(float x, float y, sf::Vector2f center)
+	{
+		float dx = x - center.x;
+		float dy = y - center.y;
+		return dx * dx + dy * dy;
+	}
+
+#ifdef GEOMETRY_USE_SSE2
+	inline __m128 getDistancesSquared(const float* positionsX, const float* positionsY, __m128 centerX, __m128 centerY)
+	{
+		__m128 dx = _mm_sub_ps(_mm_loadu_ps(positionsX), centerX);
+		__m128 dy = _mm_sub_ps(_mm_loadu_ps(positionsY), centerY);
+		return _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+	}
+#endif
+}
+
+void Geometry::distancesSquared(const float* positionsX, const float* positionsY, int count, sf::Vector2f center,
+	float* distancesSquared)
+{
+	int i = 0;
+#ifdef GEOMETRY_USE_SSE2
+	__m128 centerX = _mm_set1_ps(center.x);
+	__m128 centerY = _mm_set1_ps(center.y);
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(distancesSquared + i, getDistancesSquared(positionsX + i, positionsY + i, centerX, centerY));
+#endif
+	for (; i < count; ++i)
+		distancesSquared[i] = getDistanceSquared(positionsX[i], positionsY[i], center);
+}
+
+int Geometry::findWithinRadius(const float* positionsX, const float* positionsY, int count, sf::Vector2f center,
+	float radiusSquared, int* hits, float* hitDistancesSquared)
+{
+	int hitCount = 0;
+	int i = 0;
+#ifdef GEOMETRY_USE_SSE2
+	__m128 centerX = _mm_set1_ps(center.x);
+	__m128 centerY = _mm_set1_ps(center.y);
+	__m128 limit = _mm_set1_ps(radiusSquared);
+	alignas(16) float distances[4];
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 distancesSquared = getDistancesSquared(positionsX + i, positionsY + i, centerX, centerY);
+		int mask = _mm_movemask_ps(_mm_cmple_ps(distancesSquared, limit));
+		if (mask == 0)
+			continue;
+
+		// Compact the lanes that passed, keeping their order
+		_mm_store_ps(distances, distancesSquared);
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			if (mask & (1 << lane))
+			{
+				hits[hitCount] = i + lane;
+				hitDistancesSquared[hitCount] = distances[lane];
+				hitCount++;
+			}
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		float distanceSquared = getDistanceSquared(positionsX[i], positionsY[i], center);
+		if (distanceSquared <= radiusSquared)
+		{
+			hits[hitCount] = i;
+			hitDistancesSquared[hitCount] = distanceSquared;
+			hitCount++;
+		}
+	}
+	return hitCount;
+}
+
+bool Geometry::isAnyWithinRadius(const float* positionsX, const float* positionsY, int count, sf::Vector2f center,
+	float radiusSquared)
+{
+	int i = 0;
+#ifdef GEOMETRY_USE_SSE2
+	__m128 centerX = _mm_set1_ps(center.x);
+	__m128 centerY = _mm_set1_ps(center.y);
+	__m128 limit = _mm_set1_ps(radiusSquared);
+	for (; i + 4 <= count; i += 4)
+	{
+		if (_mm_movemask_ps(_mm_cmple_ps(getDistancesSquared(positionsX + i, positionsY + i, centerX, centerY), limit)) != 0)
+			return true;
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		if (getDistanceSquared(positionsX[i], positionsY[i], center) <= radiusSquared)
+			return true;
+	}
+	return false;
+}
+
+bool Geometry::isVectorized()
+{
+#ifdef GEOMETRY_USE_SSE2
+	return true;
+#else
+	return false;
+#endif
+}
@@ -7,140 +7,168 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include "Grid.hpp"
 #include "Utility.hpp"
 
 const float Grid::TILE_SIZE = 120.f;
 
-Grid::Grid(int cols, int rows) :
+Grid::Grid(int cols, int rows, Rng& rng) :
 	cols(cols),
-	rows(rows)
+	rows(rows),
+	shadeSeed(0),
+	selectedTileCoordinates(-1, -1),
+	revision(0),
+	pathingMode(PathingMode::Lane)
 {
-	generateNewRandomLevel(cols, rows);
+	generateNewRandomLevel(cols, rows, rng);
 }
 
-void Grid::render(float interpolationFactor, sf::RenderWindow& window)
+void Grid::generateNewRandomLevel(int cols, int rows, Rng& rng, PathingMode pathingMode)
 {
-	Tile* selectedTile = nullptr;
-
-	for (auto& row : tiles)
+	this->cols = cols;
+	this->rows = rows;
+	this->pathingMode = pathingMode;
+	shadeSeed = static_cast<std::uint32_t>(rng.next());
+
+	// Reuses the previous level's storage when the size is unchanged
+	tiles.assign(static_cast<size_t>(cols) * rows, Tile::Type::Unassigned);
+
+	// Paths are never generated in the first and last rows, which are buildable tiles either way
+	const int topRow = 1;
+	const int bottomRow = rows - 2;
+
+	int currentRow = rng.range(topRow, bottomRow);
+	tiles[getIndex(0, currentRow)] = Tile::Type::Start;
+	startTileCoordinates = { 0, currentRow };
+
+	// Enemies enter from one tile off the left edge of the grid. The path turns only where it moves
+	// vertically, so the waypoints are added as it is laid out instead of tracing it afterwards.
+	path.clear();
+	path.addWaypoint(Utility::tileToPixelPosition(-1, currentRow));
+
+	// The path is connected, so the rows it covers are exactly those between the highest and lowest
+	// rows it has visited. Every row has a path tile once it has reached both the top and bottom rows.
+	int highestRow = currentRow;
+	int lowestRow = currentRow;
+	int previousTileDirection = 0;
+
+	// Fill the grid with pathable tiles randomly from left to right
+	// Start from the second column (index 1) to avoid the first column
+	for (int col = 1; col < cols; ++col)
 	{
-		for (auto& tile : row)
+		int previousRow = currentRow;
+		int nextTileDirection = 0;
+		int verticalSteps = 0;
+
+		// Don't move up or down if at the last column
+		if (col != cols - 1)
 		{
-			tile.render(interpolationFactor, window);
-			if (tile.isSelected)
-				selectedTile = &tile;
+			// Randomly roll for a new direction
+			int roll = rng.range(0, 9);
+			verticalSteps = rng.range(1, rows);
+
+			// Move up (50% chance), but only if last move was not down
+			if (roll < 5 && previousTileDirection != 1)
+				nextTileDirection = -1;
+			// Move down (50% chance), but only if last move was not up
+			else if (roll > 4 && previousTileDirection != -1)
+				nextTileDirection = 1;
+			// Otherwise, stay in the same row
+
+			// If the rolled move would leave too few columns to still reach the top and bottom rows,
+			// take the move that reaches them soonest instead. Columns before the last one can each
+			// cross the whole grid, so this only takes over within the last few columns.
+			int remainingColumns = cols - 2 - col; // Columns after this one that can still move
+			int rolledRow = std::clamp(currentRow + nextTileDirection * verticalSteps, topRow, bottomRow);
+			if (getColumnsToCoverAllRows(std::min(highestRow, rolledRow), std::max(lowestRow, rolledRow), nextTileDirection, rows) > remainingColumns)
+			{
+				nextTileDirection = getDirectionToCoverAllRows(highestRow, lowestRow, currentRow, previousTileDirection, rows);
+				verticalSteps = rows;
+			}
 		}
-	}
-
-	if (selectedTile)
-	{
-		selectedTile->render(interpolationFactor, window);
-	}
-}
-
-void Grid::generateNewRandomLevel(int cols, int rows)
-{
-	bool doAllRowsHavePathableTiles = false;
-
-	while (!doAllRowsHavePathableTiles)
-	{
-		// Initialize a grid of tiles with dimensions rows x cols
-		std::vector<std::vector<Tile>> level(rows, std::vector<Tile>(cols, Tile(Tile::Type::Unassigned, 0, 0, 0.f)));
 
-		std::vector<bool> rowHasPathableTile(rows, false);
-		// Set the first and last rows as pathable tiles because paths will never be generated in the first and last rows
-		rowHasPathableTile[0] = true;
-		rowHasPathableTile[size_t(rows - 1)] = true;
+		previousTileDirection = nextTileDirection;
 
-		int currentRow = Utility::randomNumber(1, rows - 2);
-		int currentCol = 0;
-		level[currentRow][currentCol] = Tile(Tile::Type::Start, currentCol, currentRow, TILE_SIZE);
-		startTileCoordinates = { currentCol, currentRow };
+		// Move vertically, staying within the second-to-top and second-to-bottom rows, and connect
+		// the previous row to the new one orthogonally
+		currentRow = std::clamp(currentRow + nextTileDirection * verticalSteps, topRow, bottomRow);
+		highestRow = std::min(highestRow, currentRow);
+		lowestRow = std::max(lowestRow, currentRow);
 
-		int previousTileDirection = 0;
+		int step = (currentRow >= previousRow) ? 1 : -1;
+		for (int row = previousRow; row != currentRow; row += step)
+			tiles[getIndex(col, row)] = Tile::Type::Pathable;
 
-		// Fill the grid with pathable tiles randomly from left to right
-		// Start from the second column (index 1) to avoid the first column
-		for (int col = 1; col < cols; ++col)
+		// A vertical move never doubles back into the previous column, so enemies follow it exactly
+		if (currentRow != previousRow)
 		{
-			int previousRow = currentRow;
-			int previousCol = col - 1;
-
-			// Randomly roll for a new direction
-			int roll = Utility::randomNumber(0, 9);
-			int verticalSteps = Utility::randomNumber(1, rows);
-			int nextTileDirection = 0;
+			path.addWaypoint(Utility::tileToPixelPosition(col, previousRow));
+			path.addWaypoint(Utility::tileToPixelPosition(col, currentRow));
+		}
 
-			// Don't move up or down if at the last column
-			if (col != cols - 1)
-			{
-				// Move up (50% chance), but only if last move was not down
-				if (roll < 5 && previousTileDirection != 1)
-					nextTileDirection = -1;
-				// Move down (50% chance), but only if last move was not up
-				else if (roll > 4 && previousTileDirection != -1)
-					nextTileDirection = 1;
-				// Otherwise, stay in the same row (0% chance)
-			}
+		// The last tile of the path is the end tile
+		tiles[getIndex(col, currentRow)] = (col != cols - 1) ? Tile::Type::Pathable : Tile::Type::End;
+	}
 
-			previousTileDirection = nextTileDirection;
+	// Fill the rest of the grid with buildable tiles
+	std::replace(tiles.begin(), tiles.end(), Tile::Type::Unassigned, Tile::Type::Buildable);
 
-			// Perform the vertical step movement
-			for (int i = 0; i < verticalSteps; ++i)
-			{
-				// Add the direction to the current row to determine the next tile's row.
-				// Ensure it stays within the bounds of the grid and doesn't move
-				// up if at the second-to-top row or down if at the second-to-bottom row
-				currentRow = std::clamp(currentRow + nextTileDirection, 1, rows - 2);
-				level[currentRow][col] = Tile(Tile::Type::Pathable, col, currentRow, TILE_SIZE);
-				rowHasPathableTile[currentRow] = true;
-			}
+	// Enemies leave one tile past the end tile
+	path.addWaypoint(Utility::tileToPixelPosition(cols, currentRow));
 
-			// Ensure orthogonal connection if the next tile is not in the same row
-			if (currentRow != previousRow)
-			{
-				int step = (currentRow > previousRow) ? 1 : -1;
-				for (int row = previousRow; row != currentRow; row += step)
-				{
-					level[row][col] = Tile(Tile::Type::Pathable, col, row, TILE_SIZE);
-					rowHasPathableTile[currentRow] = true;
-				}
-			}
+	// Maze levels keep only the ends of the carved path; enemies find their own way between them
+	if (pathingMode == PathingMode::Maze)
+	{
+		std::replace(tiles.begin(), tiles.end(), Tile::Type::Pathable, Tile::Type::Buildable);
+		path.clear();
+		flowField.build(cols, rows, tiles, { cols - 1, currentRow });
+	}
 
-			// Fill the current tile with a pathable tile
-			if (col != cols - 1)
-			{
-				// Set the current tile as a pathable tile
-				level[currentRow][col] = Tile(Tile::Type::Pathable, col, currentRow, TILE_SIZE);
-				rowHasPathableTile[currentRow] = true;
-			}
-			else
-			{
-				// Set the last tile as the end tile
-				level[currentRow][col] = Tile(Tile::Type::End, col, currentRow, TILE_SIZE);
-			}
-		}
+	selectedTileCoordinates = { -1, -1 };
+	revision++;
+}
 
-		// Check if all rows have at least one pathable tile
-		if (std::all_of(rowHasPathableTile.begin(), rowHasPathableTile.end(), [](bool hasPathableTile) { return hasPathableTile; }))
-			doAllRowsHavePathableTiles = true;
+int Grid::getColumnsToCoverAllRows(int highestRow, int lowestRow, int previousTileDirection, int rows)
+{
+	bool isTopMissing = highestRow > 1;
+	bool isBottomMissing = lowestRow < rows - 2;
+
+	// Reversing direction needs a straight column in between, which is one column more
+	int columnsToTop = (previousTileDirection == 1) ? 2 : 1;
+	int columnsToBottom = (previousTileDirection == -1) ? 2 : 1;
+
+	if (isTopMissing && isBottomMissing)
+		return std::min(columnsToTop, columnsToBottom) + 2;
+	if (isTopMissing)
+		return columnsToTop;
+	if (isBottomMissing)
+		return columnsToBottom;
+	return 0;
+}
 
-		// Fill the rest of the grid with buildable tiles
-		for (int row = 0; row < rows; ++row)
-		{
-			for (int col = 0; col < cols; ++col)
-			{
-				if (level[row][col].getType() == Tile::Type::Unassigned)
-				{
-					level[row][col] = Tile(Tile::Type::Buildable, col, row, TILE_SIZE);
-				}
-			}
-		}
+int Grid::getDirectionToCoverAllRows(int highestRow, int lowestRow, int currentRow, int previousTileDirection, int rows)
+{
+	bool isTopMissing = highestRow > 1;
+	bool isBottomMissing = lowestRow < rows - 2;
 
-		tiles = std::move(level);
+	// With both missing, head for the one that is not behind a reversal, or else the nearer one
+	bool goUp = isTopMissing;
+	if (isTopMissing && isBottomMissing)
+	{
+		if (previousTileDirection != 0)
+			goUp = previousTileDirection == -1;
+		else
+			goUp = currentRow - 1 <= rows - 2 - currentRow;
 	}
+	else if (!isTopMissing && !isBottomMissing)
+		return 0;
+
+	// Moving against the previous direction is not allowed, so go straight for a column first
+	int direction = goUp ? -1 : 1;
+	return (direction == -previousTileDirection) ? 0 : direction;
 }
 
 void Grid::selectTile(sf::Vector2i tilePosition)
@@ -148,26 +176,44 @@ void Grid::selectTile(sf::Vector2i tilePosition)
 	if (tilePosition.x < 0 || tilePosition.x >= cols || tilePosition.y < 0 || tilePosition.y >= rows)
 		return;
 
-	deselectAllTiles();
-	tiles[tilePosition.y][tilePosition.x].isSelected = true;
+	selectedTileCoordinates = tilePosition;
 }
 
 void Grid::deselectAllTiles()
 {
-	for (auto& row : tiles)
-	{
-		for (auto& tile : row)
-		{
-			tile.isSelected = false;
-		}
-	}
+	selectedTileCoordinates = { -1, -1 };
 }
 
 void Grid::markTileAsTower(sf::Vector2i tilePosition)
 {
 	if (tilePosition.x < 0 || tilePosition.x >= cols || tilePosition.y < 0 || tilePosition.y >= rows)
 		return;
-	tiles[tilePosition.x][tilePosition.y].markAsTower();
+	tiles[getIndex(tilePosition.x, tilePosition.y)] = Tile::Type::Tower;
+	revision++;
+
+	if (pathingMode == PathingMode::Maze)
+		flowField.block(tilePosition);
+}
+
+void Grid::markTileAsBuildable(sf::Vector2i tilePosition)
+{
+	if (getTileType(tilePosition) != Tile::Type::Tower)
+		return;
+	tiles[getIndex(tilePosition.x, tilePosition.y)] = Tile::Type::Buildable;
+	revision++;
+
+	if (pathingMode == PathingMode::Maze)
+		flowField.unblock(tilePosition);
+}
+
+bool Grid::wouldBlockPath(sf::Vector2i tilePosition, const std::vector<sf::Vector2i>& occupiedTiles) const
+{
+	if (pathingMode != PathingMode::Maze)
+		return false;
+
+	std::vector<sf::Vector2i> sources(occupiedTiles);
+	sources.push_back(startTileCoordinates);
+	return flowField.wouldDisconnect(tilePosition, sources);
 }
 
 Tile::Type Grid::getTileType(int col, int row) const
@@ -175,7 +221,7 @@ Tile::Type Grid::getTileType(int col, int row) const
 	if (row < 0 || row >= rows || col < 0 || col >= cols)
 		return Tile::Type::Unassigned;
 
-	return tiles[row][col].getType();
+	return tiles[getIndex(col, row)];
 }
 
 Tile::Type Grid::getTileType(sf::Vector2i tilePosition) const
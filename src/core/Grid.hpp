@@ -2,9 +2,8 @@
 // File: Grid.hpp
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: April 28, 2025
-// Description: Defines the Grid class, which contains a collection of Tile objects representing 
-//              the game grid. It is responsible for initializing the grid and rendering it to the 
-//              window.
+// Description: Defines the Grid class, which contains the tiles making up the game grid. It is
+//              responsible for generating levels and keeping track of the selected tile.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -12,31 +11,79 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
+#include "FlowField.hpp"
 #include "Tile.hpp"
+#include "Path.hpp"
+#include "Rng.hpp"
 
 class Grid
 {
 public:
-	Grid(int cols, int rows);
+	// On lane levels enemies follow the path carved by the generator. On maze levels every tile
+	// but the start and end is open ground, and enemies follow a flow field around the towers.
+	enum class PathingMode : std::uint8_t
+	{
+		Lane,
+		Maze
+	};
 
-	void render(float interpolationFactor, sf::RenderWindow& window);
+	Grid(int cols, int rows, Rng& rng);
 
-	void generateNewRandomLevel(int cols, int rows);
+	// The level only depends on the state of the rng, so equal seeds give equal levels.
+	// The path always has a tile in every row but the first and last, without retrying; this
+	// needs at least 5 columns, as reaching the top and bottom may take three turning columns.
+	// Maze levels are generated the same way, and then everything but the start and end tiles
+	// is turned into open ground.
+	void generateNewRandomLevel(int cols, int rows, Rng& rng, PathingMode pathingMode = PathingMode::Lane);
+
+	// Size of the whole grid in pixels
+	inline sf::Vector2f getPixelSize() const { return { cols * TILE_SIZE, rows * TILE_SIZE }; }
 
 	void selectTile(sf::Vector2i tilePosition);
 	void deselectAllTiles();
 	void markTileAsTower(sf::Vector2i tilePosition);
+	// Returns a tower tile to buildable ground once its tower is sold
+	void markTileAsBuildable(sf::Vector2i tilePosition);
+	// On maze levels, whether a tower on the tile would cut any of the given tiles (along with
+	// the start tile) off from the end tile. Always false on lane levels.
+	bool wouldBlockPath(sf::Vector2i tilePosition, const std::vector<sf::Vector2i>& occupiedTiles) const;
 
 	inline sf::Vector2u getSize() const { return sf::Vector2u(cols, rows); }
 	inline sf::Vector2i getStartTile() const {	return startTileCoordinates; }
+	inline PathingMode getPathingMode() const { return pathingMode; }
+	// (-1, -1) when no tile is selected
+	inline sf::Vector2i getSelectedTile() const { return selectedTileCoordinates; }
+	// Changes whenever a tile changes or a new level is generated, so the tiles only need to be
+	// redrawn when it does
+	inline std::uint32_t getRevision() const { return revision; }
+	// Varies the grass shades from level to level
+	inline std::uint32_t getShadeSeed() const { return shadeSeed; }
+	// Only used on lane levels; empty on maze levels
+	inline const Path& getPath() const { return path; }
+	// Only used on maze levels
+	inline const FlowField& getFlowField() const { return flowField; }
 	Tile::Type getTileType(int col, int row) const;
 	Tile::Type getTileType(sf::Vector2i tilePosition) const;
 
 	static const float TILE_SIZE;
 
 private:
+	// Fewest columns the path still needs to reach both the second-to-top and second-to-bottom rows
+	static int getColumnsToCoverAllRows(int highestRow, int lowestRow, int previousTileDirection, int rows);
+	// The vertical direction (-1, 0 or 1) to move in to reach them in that many columns
+	static int getDirectionToCoverAllRows(int highestRow, int lowestRow, int currentRow, int previousTileDirection, int rows);
+
+	inline int getIndex(int col, int row) const { return row * cols + col; }
+
 	int cols, rows;
-	std::vector<std::vector<Tile>> tiles;
+	std::vector<Tile::Type> tiles; // Row-major
+	std::uint32_t shadeSeed;       // Varies the grass shades from level to level
 	sf::Vector2i startTileCoordinates;
+	sf::Vector2i selectedTileCoordinates; // (-1, -1) when no tile is selected
+	std::uint32_t revision;
+	PathingMode pathingMode;
+	Path path;
+	FlowField flowField;
 };
\ No newline at end of file
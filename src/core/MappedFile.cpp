@@ -0,0 +1,128 @@
+// ================================================================================================
+// File: MappedFile.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 23, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() :
+	data(nullptr),
+	size(0)
+#ifdef _WIN32
+	, fileHandle(nullptr),
+	mappingHandle(nullptr)
+#endif
+{}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& filename)
+{
+	close();
+
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	data = static_cast<const std::uint8_t*>(view);
+	size = static_cast<std::size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (data)
+		UnmapViewOfFile(data);
+	if (mappingHandle)
+		CloseHandle(mappingHandle);
+	if (fileHandle)
+		CloseHandle(fileHandle);
+
+	data = nullptr;
+	size = 0;
+	fileHandle = nullptr;
+	mappingHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::open(const std::string& filename)
+{
+	close();
+
+	int file = ::open(filename.c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat fileStats;
+	if (fstat(file, &fileStats) != 0 || fileStats.st_size == 0)
+	{
+		::close(file);
+		return false;
+	}
+
+	void* view = mmap(nullptr, static_cast<std::size_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file); // The mapping keeps the file alive on its own
+
+	if (view == MAP_FAILED)
+		return false;
+
+	data = static_cast<const std::uint8_t*>(view);
+	size = static_cast<std::size_t>(fileStats.st_size);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (data)
+		munmap(const_cast<std::uint8_t*>(data), size);
+
+	data = nullptr;
+	size = 0;
+}
+
+#endif
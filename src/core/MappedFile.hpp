@@ -0,0 +1,43 @@
+// ================================================================================================
+// File: MappedFile.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 23, 2025
+// Description: Defines the MappedFile class, which maps a whole file read-only into memory. Pages
+//              are only read from disk when they are first touched, and the mapping stays valid
+//              until the MappedFile is closed or destroyed.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	// Returns false if the file does not exist, is empty or could not be mapped
+	bool open(const std::string& filename);
+	void close();
+
+	inline bool isOpen() const { return data != nullptr; }
+	inline const std::uint8_t* getData() const { return data; }
+	inline std::size_t getSize() const { return size; }
+
+private:
+	const std::uint8_t* data;
+	std::size_t size;
+
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#endif
+};
@@ -0,0 +1,62 @@
+// ================================================================================================
+// File: Path.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 15, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "Path.hpp"
+#include "Utility.hpp"
+
+void Path::clear()
+{
+	waypoints.clear();
+	cumulativeLengths.clear();
+	directions.clear();
+}
+
+void Path::addWaypoint(sf::Vector2f waypoint)
+{
+	if (waypoints.empty())
+	{
+		cumulativeLengths.push_back(0.f);
+	}
+	else
+	{
+		cumulativeLengths.push_back(cumulativeLengths.back() + Utility::distance(waypoints.back(), waypoint));
+		directions.push_back(Utility::normalize(waypoint - waypoints.back()));
+	}
+	waypoints.push_back(waypoint);
+}
+
+sf::Vector2f Path::getPositionAt(float distance) const
+{
+	if (waypoints.empty())
+		return { 0.f, 0.f };
+	if (distance <= 0.f)
+		return waypoints.front();
+	if (distance >= getLength())
+		return waypoints.back();
+
+	std::size_t segment = findSegment(distance);
+	return waypoints[segment] + directions[segment] * (distance - cumulativeLengths[segment]);
+}
+
+sf::Vector2f Path::getDirectionAt(float distance) const
+{
+	if (directions.empty())
+		return { 1.f, 0.f };
+
+	return directions[findSegment(distance)];
+}
+
+std::size_t Path::findSegment(float distance) const
+{
+	// First waypoint that lies beyond the distance ends the segment
+	auto end = std::upper_bound(cumulativeLengths.begin(), cumulativeLengths.end(), distance);
+	std::size_t segment = static_cast<std::size_t>(std::max<std::ptrdiff_t>(end - cumulativeLengths.begin() - 1, 0));
+	return std::min(segment, directions.size() - 1);
+}
@@ -0,0 +1,40 @@
+// ================================================================================================
+// File: Path.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 15, 2025
+// Description: Defines the Path class, an ordered list of waypoints with precomputed cumulative
+//              arc lengths. The grid bakes the enemy path into it once per level, so enemies only
+//              need to track how far along the path they are to know where they are.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+
+class Path
+{
+public:
+	void clear();
+	void addWaypoint(sf::Vector2f waypoint);
+
+	// Returns the point at the given distance along the path, clamped to its ends.
+	sf::Vector2f getPositionAt(float distance) const;
+	// Returns the unit direction of travel at the given distance along the path.
+	sf::Vector2f getDirectionAt(float distance) const;
+
+	inline float getLength() const { return cumulativeLengths.empty() ? 0.f : cumulativeLengths.back(); }
+	inline const std::vector<sf::Vector2f>& getWaypoints() const { return waypoints; }
+	inline const std::vector<float>& getCumulativeLengths() const { return cumulativeLengths; }
+
+private:
+	// Returns the index of the segment containing the given distance
+	std::size_t findSegment(float distance) const;
+
+	std::vector<sf::Vector2f> waypoints;
+	std::vector<float> cumulativeLengths;    // Distance from the first waypoint to each waypoint
+	std::vector<sf::Vector2f> directions;    // Unit direction of each segment
+};
@@ -0,0 +1,132 @@
+// ================================================================================================
+// File: Profiler.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 20, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "Profiler.hpp"
+
+Profiler::Profiler() :
+	nextSample(0),
+	frameCount(0),
+	droppedTime(0.f)
+{
+	currentFrame.fill(0.f);
+	for (auto& samples : sectionSamples)
+		samples.resize(WINDOW_SIZE, 0.f);
+	fixedUpdateSamples.resize(WINDOW_SIZE, 0.f);
+}
+
+void Profiler::endFrame(int fixedUpdates)
+{
+	for (int section = 0; section < static_cast<int>(Section::Count); ++section)
+	{
+		sectionSamples[section][nextSample] = currentFrame[section];
+		currentFrame[section] = 0.f;
+	}
+	fixedUpdateSamples[nextSample] = static_cast<float>(fixedUpdates);
+
+	nextSample = (nextSample + 1) % WINDOW_SIZE;
+	frameCount++;
+}
+
+Profiler::Stats Profiler::getStats(Section section) const
+{
+	return computeStats(sectionSamples[static_cast<int>(section)], std::min(frameCount, WINDOW_SIZE));
+}
+
+Profiler::Stats Profiler::getFixedUpdatesPerFrameStats() const
+{
+	return computeStats(fixedUpdateSamples, std::min(frameCount, WINDOW_SIZE));
+}
+
+bool Profiler::writeCsv(const std::string& filename) const
+{
+	std::ofstream file(filename);
+	if (!file)
+	{
+		std::cerr << "Error: Could not write profile to " << filename << std::endl;
+		return false;
+	}
+
+	file << "section,min,avg,p99,max\n";
+	for (int section = 0; section < static_cast<int>(Section::Count); ++section)
+	{
+		Stats stats = getStats(static_cast<Section>(section));
+		file << getSectionName(static_cast<Section>(section)) << "_ms," << stats.min << "," << stats.avg << "," << stats.p99 << "," << stats.max << "\n";
+	}
+	Stats updates = getFixedUpdatesPerFrameStats();
+	file << "FixedUpdatesPerFrame," << updates.min << "," << updates.avg << "," << updates.p99 << "," << updates.max << "\n";
+	file << "DroppedSimulationTime_s," << droppedTime << "," << droppedTime << "," << droppedTime << "," << droppedTime << "\n";
+	return true;
+}
+
+std::string Profiler::getSummary() const
+{
+	std::ostringstream ss;
+	ss << std::fixed << std::setprecision(2);
+	ss << "ms (last " << std::min(frameCount, WINDOW_SIZE) << " frames)   min / avg / p99\n";
+
+	for (int section = 0; section < static_cast<int>(Section::Count); ++section)
+	{
+		Stats stats = getStats(static_cast<Section>(section));
+		ss << getSectionName(static_cast<Section>(section)) << ": " << stats.min << " / " << stats.avg << " / " << stats.p99 << "\n";
+	}
+	Stats updates = getFixedUpdatesPerFrameStats();
+	ss << "Fixed updates per frame: " << updates.min << " / " << updates.avg << " / " << updates.p99 << "\n";
+	ss << "Dropped simulation time: " << droppedTime << "s";
+	return ss.str();
+}
+
+const char* Profiler::getSectionName(Section section)
+{
+	switch (section)
+	{
+	case Section::Frame:             return "Frame";
+	case Section::ProcessInput:      return "ProcessInput";
+	case Section::Update:            return "Update";
+	case Section::UpdateEffects:     return "UpdateEffects";
+	case Section::UpdateWave:        return "UpdateWave";
+	case Section::EnemyUpdate:       return "EnemyUpdate";
+	case Section::ProjectileUpdate:  return "ProjectileUpdate";
+	case Section::TowerUpdate:       return "TowerUpdate";
+	case Section::TowerMerge:        return "TowerMerge";
+	case Section::RemoveFinished:    return "RemoveFinished";
+	case Section::UIUpdate:          return "UIUpdate";
+	case Section::RenderGrid:        return "RenderGrid";
+	case Section::RenderTowers:      return "RenderTowers";
+	case Section::RenderBatch:       return "RenderBatch";
+	case Section::RenderUI:          return "RenderUI";
+	case Section::Display:           return "Display";
+	default:                         return "Unknown";
+	}
+}
+
+Profiler::Stats Profiler::computeStats(const std::vector<float>& samples, int count)
+{
+	Stats stats;
+	if (count == 0)
+		return stats;
+
+	// Only the first count samples have been written while the window is filling up
+	std::vector<float> sorted(samples.begin(), samples.begin() + count);
+	std::sort(sorted.begin(), sorted.end());
+
+	float sum = 0.f;
+	for (float sample : sorted)
+		sum += sample;
+
+	stats.min = sorted.front();
+	stats.max = sorted.back();
+	stats.avg = sum / count;
+	stats.p99 = sorted[std::min(count - 1, static_cast<int>(count * 0.99f))];
+	return stats;
+}
@@ -0,0 +1,111 @@
+// ================================================================================================
+// File: Profiler.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 20, 2025
+// Description: Defines the Profiler class, which measures how long each system takes per frame.
+//              Scoped timers add their time to a section of the current frame; at the end of the
+//              frame the totals are pushed into a rolling window of recent frames, from which the
+//              min/avg/p99/max are computed for the overlay and the CSV dump. The number of fixed
+//              updates run per frame is tracked as well, since a growing count is the first sign of
+//              the accumulator falling behind.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+class Profiler
+{
+public:
+	enum class Section
+	{
+		Frame,
+		ProcessInput,
+		Update,
+		UpdateEffects,
+		UpdateWave,
+		EnemyUpdate,
+		ProjectileUpdate,
+		TowerUpdate,
+		TowerMerge,
+		RemoveFinished,
+		UIUpdate,
+		RenderGrid,
+		RenderTowers,
+		RenderBatch,
+		RenderUI,
+		Display,
+		Count
+	};
+
+	struct Stats
+	{
+		float min = 0.f;
+		float avg = 0.f;
+		float p99 = 0.f;
+		float max = 0.f;
+	};
+
+	// Adds the time of one scope to a section of the current frame. Does nothing without a profiler.
+	class ScopedTimer
+	{
+	public:
+		inline ScopedTimer(Profiler* profiler, Section section) :
+			profiler(profiler),
+			section(section),
+			start(profiler ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+		{}
+		inline ~ScopedTimer()
+		{
+			if (profiler)
+				profiler->addTime(section, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		Profiler* profiler;
+		Section section;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	Profiler();
+
+	inline void addTime(Section section, float milliseconds) { currentFrame[static_cast<int>(section)] += milliseconds; }
+	// Closes the current frame and adds it to the rolling window.
+	void endFrame(int fixedUpdates);
+
+	// Stats in milliseconds over the frames in the window
+	Stats getStats(Section section) const;
+	Stats getFixedUpdatesPerFrameStats() const;
+	inline int getFrameCount() const { return frameCount; }
+
+	// Simulation time skipped because a frame hit the fixed update cap, since startup
+	inline void addDroppedTime(float seconds) { droppedTime += seconds; }
+	inline float getDroppedTime() const { return droppedTime; }
+
+	// Writes the stats of every section as CSV. Returns false if the file could not be written.
+	bool writeCsv(const std::string& filename) const;
+	// Multi-line text for the overlay
+	std::string getSummary() const;
+
+	static const char* getSectionName(Section section);
+
+	static constexpr int WINDOW_SIZE = 600; // frames, 10 seconds at 60 FPS
+
+private:
+	static Stats computeStats(const std::vector<float>& samples, int count);
+
+	std::array<float, static_cast<int>(Section::Count)> currentFrame;
+	std::array<std::vector<float>, static_cast<int>(Section::Count)> sectionSamples;
+	std::vector<float> fixedUpdateSamples;
+	int nextSample;
+	int frameCount;
+	float droppedTime;
+};
@@ -0,0 +1,185 @@
+// ================================================================================================
+// File: Replay.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 19, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include "Replay.hpp"
+#include "Utility.hpp"
+
+const char Replay::MAGIC[4] = { 'T', 'D', 'R', 'P' };
+// Bumped whenever the same commands would play out differently, as well as when the format
+// changes. Only replays of the current version are played back; older ones were recorded under
+// different rules (e.g. version 4 generated different levels from the same seed) and would not
+// reproduce their games.
+const std::uint8_t Replay::VERSION = 5;
+
+namespace
+{
+	// LEB128: 7 bits per byte, high bit set on every byte except the last
+	void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.push_back(static_cast<std::uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	bool readVarint(const std::vector<std::uint8_t>& in, std::size_t& offset, std::uint64_t& value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 64 && offset < in.size(); shift += 7)
+		{
+			std::uint8_t byte = in[offset++];
+			value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+				return true;
+		}
+		return false;
+	}
+}
+
+Replay::Replay(std::uint64_t seed, sf::Vector2i mapSize, Grid::PathingMode pathingMode) :
+	seed(seed),
+	mapSize(mapSize),
+	pathingMode(pathingMode),
+	cursor(0)
+{}
+
+void Replay::record(unsigned long long tick, const Simulation::Command& command)
+{
+	entries.push_back({ tick, command });
+}
+
+void Replay::submitDueCommands(Simulation& simulation)
+{
+	while (cursor < entries.size() && entries[cursor].tick <= simulation.getTick())
+	{
+		// Commands for ticks that have already passed cannot be applied on time, so they are dropped
+		if (entries[cursor].tick == simulation.getTick())
+			simulation.submitCommand(entries[cursor].command);
+		cursor++;
+	}
+}
+
+bool Replay::saveToFile(const std::string& filename) const
+{
+	std::vector<std::uint8_t> data(std::begin(MAGIC), std::end(MAGIC));
+	data.push_back(VERSION);
+	writeVarint(data, seed);
+	writeVarint(data, static_cast<std::uint32_t>(mapSize.x));
+	writeVarint(data, static_cast<std::uint32_t>(mapSize.y));
+	data.push_back(static_cast<std::uint8_t>(pathingMode));
+	writeVarint(data, entries.size());
+
+	unsigned long long previousTick = 0;
+	for (const Entry& entry : entries)
+	{
+		writeVarint(data, entry.tick - previousTick);
+		data.push_back(static_cast<std::uint8_t>(entry.command.type));
+		// The one byte of arguments is the policy for SetTargeting and the tower type otherwise
+		if (entry.command.type == Simulation::Command::Type::SetTargeting)
+			data.push_back(static_cast<std::uint8_t>(entry.command.targetingPolicy));
+		else
+			data.push_back(static_cast<std::uint8_t>(entry.command.towerType));
+		writeVarint(data, static_cast<std::uint32_t>(entry.command.tilePosition.x));
+		writeVarint(data, static_cast<std::uint32_t>(entry.command.tilePosition.y));
+		previousTick = entry.tick;
+	}
+
+	std::ofstream file(filename, std::ios::binary);
+	if (!file.write(reinterpret_cast<const char*>(data.data()), data.size()))
+	{
+		std::cerr << "Error: Could not write replay to " << filename << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Replay::loadFromFile(const std::string& filename)
+{
+	std::ifstream file(filename, std::ios::binary);
+	std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	if (!file.is_open() || data.size() < sizeof(MAGIC) + 1 || !std::equal(std::begin(MAGIC), std::end(MAGIC), data.begin()))
+	{
+		std::cerr << "Error: " << filename << " is not a replay file!" << std::endl;
+		return false;
+	}
+	const std::uint8_t version = data[sizeof(MAGIC)];
+	if (version != VERSION)
+	{
+		std::cerr << "Error: Unsupported replay version " << static_cast<int>(version) << " (expected "
+			<< static_cast<int>(VERSION) << "); it was recorded by another version of the game!" << std::endl;
+		return false;
+	}
+
+	std::size_t offset = sizeof(MAGIC) + 1;
+	std::uint64_t loadedSeed = 0;
+	std::uint64_t cols = 0, rows = 0;
+	Grid::PathingMode loadedPathingMode = Grid::PathingMode::Lane;
+	std::uint64_t count = 0;
+	std::vector<Entry> loadedEntries;
+	bool isValid = readVarint(data, offset, loadedSeed) &&
+		readVarint(data, offset, cols) && readVarint(data, offset, rows) &&
+		cols <= INT_MAX && rows <= INT_MAX && Utility::isValidMapSize(static_cast<int>(cols), static_cast<int>(rows));
+	if (isValid)
+	{
+		isValid = offset < data.size() && data[offset] <= static_cast<std::uint8_t>(Grid::PathingMode::Maze);
+		if (isValid)
+			loadedPathingMode = static_cast<Grid::PathingMode>(data[offset++]);
+	}
+	isValid = isValid && readVarint(data, offset, count);
+
+	unsigned long long tick = 0;
+	for (std::uint64_t i = 0; isValid && i < count; ++i)
+	{
+		std::uint64_t tickDelta = 0, x = 0, y = 0;
+		isValid = readVarint(data, offset, tickDelta) && offset + 2 <= data.size();
+		if (!isValid)
+			break;
+
+		Entry entry;
+		tick += tickDelta;
+		entry.tick = tick;
+		entry.command.type = static_cast<Simulation::Command::Type>(data[offset++]);
+		const std::uint8_t argument = data[offset++];
+		if (entry.command.type == Simulation::Command::Type::SetTargeting)
+		{
+			entry.command.targetingPolicy = static_cast<TargetIndex::Policy>(argument);
+			isValid = entry.command.targetingPolicy < TargetIndex::Policy::Count;
+		}
+		else
+		{
+			entry.command.towerType = static_cast<TowerRegistry::Type>(argument);
+			isValid = entry.command.towerType <= TowerRegistry::Type::Count;
+		}
+		isValid = isValid && readVarint(data, offset, x) && readVarint(data, offset, y) &&
+			entry.command.type <= Simulation::Command::Type::SetTargeting;
+		entry.command.tilePosition = { static_cast<int>(x), static_cast<int>(y) };
+		loadedEntries.push_back(entry);
+	}
+
+	if (!isValid)
+	{
+		std::cerr << "Error: Replay file " << filename << " is truncated or corrupt!" << std::endl;
+		return false;
+	}
+
+	seed = loadedSeed;
+	mapSize = { static_cast<int>(cols), static_cast<int>(rows) };
+	pathingMode = loadedPathingMode;
+	entries = std::move(loadedEntries);
+	cursor = 0;
+	return true;
+}
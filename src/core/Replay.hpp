@@ -0,0 +1,64 @@
+// ================================================================================================
+// File: Replay.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 19, 2025
+// Description: Defines the Replay class, a log of the commands a game received, keyed by the
+//              fixed step tick they were applied on, together with the game's seed, map size and
+//              pathing mode. Since the simulation is deterministic, submitting the same commands
+//              on the same ticks to a simulation reset with the same seed reproduces the game
+//              exactly.
+//              Replays are saved in a compact binary format: a small header followed by one record
+//              per command, with the tick stored as the difference to the previous record and all
+//              numbers stored as variable-length integers (a few bytes per command).
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Simulation.hpp"
+
+class Replay
+{
+public:
+	explicit Replay(std::uint64_t seed = 0, sf::Vector2i mapSize = { 10, 8 }, Grid::PathingMode pathingMode = Grid::PathingMode::Lane);
+
+	// Appends a command; ticks must not decrease between calls.
+	void record(unsigned long long tick, const Simulation::Command& command);
+
+	// Submits every command recorded for the simulation's current tick. Call before each update.
+	void submitDueCommands(Simulation& simulation);
+	// Starts playback from the first command again.
+	inline void rewind() { cursor = 0; }
+	inline bool isFinished() const { return cursor >= entries.size(); }
+
+	inline std::uint64_t getSeed() const { return seed; }
+	inline sf::Vector2i getMapSize() const { return mapSize; }
+	inline Grid::PathingMode getPathingMode() const { return pathingMode; }
+	inline std::size_t getCommandCount() const { return entries.size(); }
+	inline unsigned long long getLastTick() const { return entries.empty() ? 0 : entries.back().tick; }
+
+	// Return false (and print the reason) if the file could not be written or read.
+	bool saveToFile(const std::string& filename) const;
+	bool loadFromFile(const std::string& filename);
+
+private:
+	struct Entry
+	{
+		unsigned long long tick;
+		Simulation::Command command;
+	};
+
+	std::uint64_t seed;
+	sf::Vector2i mapSize;
+	Grid::PathingMode pathingMode;
+	std::vector<Entry> entries;
+	std::size_t cursor;
+
+	static const char MAGIC[4];
+	static const std::uint8_t VERSION;
+};
@@ -0,0 +1,81 @@
+// ================================================================================================
+// File: Rng.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 18, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <random>
+#include "Rng.hpp"
+
+Rng::Rng(std::uint64_t seed) :
+	state(0),
+	initialSeed(0)
+{
+	this->seed(seed);
+}
+
+void Rng::seed(std::uint64_t seed)
+{
+	initialSeed = seed;
+
+	// Standard PCG32 seeding, so nearby seeds still produce unrelated sequences
+	state = 0;
+	next();
+	state += seed;
+	next();
+}
+
+int Rng::range(int min, int max)
+{
+	std::uint64_t span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+	return toRange(next(), min, span);
+}
+
+float Rng::range(float min, float max)
+{
+	return toRange(next(), min, max);
+}
+
+void Rng::fill(int* out, std::size_t count, int min, int max)
+{
+	std::uint64_t span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+	std::uint64_t states[FILL_CHUNK];
+	for (std::size_t first = 0; first < count; first += FILL_CHUNK)
+	{
+		std::size_t chunk = std::min(FILL_CHUNK, count - first);
+		collectStates(states, chunk);
+		for (std::size_t i = 0; i < chunk; ++i)
+			out[first + i] = toRange(output(states[i]), min, span);
+	}
+}
+
+void Rng::fill(float* out, std::size_t count, float min, float max)
+{
+	std::uint64_t states[FILL_CHUNK];
+	for (std::size_t first = 0; first < count; first += FILL_CHUNK)
+	{
+		std::size_t chunk = std::min(FILL_CHUNK, count - first);
+		collectStates(states, chunk);
+		for (std::size_t i = 0; i < chunk; ++i)
+			out[first + i] = toRange(output(states[i]), min, max);
+	}
+}
+
+void Rng::collectStates(std::uint64_t* states, std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		states[i] = state;
+		state = state * MULTIPLIER + INCREMENT;
+	}
+}
+
+std::uint64_t Rng::makeRandomSeed()
+{
+	std::random_device device;
+	return (static_cast<std::uint64_t>(device()) << 32) | device();
+}
@@ -0,0 +1,80 @@
+// ================================================================================================
+// File: ScriptedPolicy.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 25, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include "ScriptedPolicy.hpp"
+
+ScriptedPolicy::ScriptedPolicy(std::vector<TowerRegistry::Type> buildOrder) :
+	buildOrder(std::move(buildOrder))
+{}
+
+void ScriptedPolicy::submitCommands(Simulation& simulation) const
+{
+	const Grid& grid = simulation.getGrid();
+	const sf::Vector2i size(grid.getSize());
+
+	TowerRegistry::Type nextType = buildOrder[simulation.getTowers().size() % buildOrder.size()];
+	int nextTowerCost = simulation.getBalance().getTowerAttributes(nextType).at(0).buyCost;
+
+	// Maze levels have no path tiles, so mark the route enemies currently take instead
+	const bool isMaze = grid.getPathingMode() == Grid::PathingMode::Maze;
+	std::vector<bool> isOnRoute;
+	if (isMaze)
+	{
+		const FlowField& flowField = grid.getFlowField();
+		isOnRoute.assign(static_cast<std::size_t>(size.x) * size.y, false);
+		for (sf::Vector2i tile = grid.getStartTile(); flowField.getDistance(tile) != FlowField::UNREACHABLE; tile = flowField.getNextTile(tile))
+		{
+			isOnRoute[static_cast<std::size_t>(tile.y) * size.x + tile.x] = true;
+			if (tile == flowField.getGoal())
+				break;
+		}
+	}
+	auto isPathTile = [&](int col, int row)
+	{
+		if (!isMaze)
+			return grid.getTileType(col, row) == Tile::Type::Pathable;
+		return col >= 0 && col < size.x && row >= 0 && row < size.y && isOnRoute[static_cast<std::size_t>(row) * size.x + col];
+	};
+
+	for (int row = 0; row < size.y; ++row)
+	{
+		for (int col = 0; col < size.x; ++col)
+		{
+			// Tiles with towers on them are not buildable
+			if (grid.getTileType(col, row) != Tile::Type::Buildable || isPathTile(col, row))
+				continue;
+
+			bool isNextToPath = false;
+			for (int dy = -1; dy <= 1 && !isNextToPath; ++dy)
+				for (int dx = -1; dx <= 1 && !isNextToPath; ++dx)
+					isNextToPath = isPathTile(col + dx, row + dy);
+
+			if (isNextToPath)
+			{
+				if (simulation.getGold() < nextTowerCost)
+					return;
+				// Tiles an enemy is on or that would close the maze are skipped
+				if (!simulation.canPlaceTower({ col, row }))
+					continue;
+				simulation.submitCommand({ Simulation::Command::Type::PlaceTower, { col, row }, nextType });
+				return;
+			}
+		}
+	}
+
+	for (auto& tower : simulation.getTowers())
+	{
+		if (tower->getLevel() < tower->getMaxLevel())
+		{
+			if (simulation.getGold() >= tower->getAttributes().at(tower->getLevel() + 1).buyCost)
+				simulation.submitCommand({ Simulation::Command::Type::UpgradeTower, tower->getTilePosition() });
+			return;
+		}
+	}
+}
@@ -0,0 +1,32 @@
+// ================================================================================================
+// File: ScriptedPolicy.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 25, 2025
+// Description: Defines the ScriptedPolicy class, a fixed strategy standing in for the player in
+//              headless games. It builds towers on the free buildable tiles next to the path, from
+//              the top left, cycling through a build order, and upgrades the existing towers once
+//              there is nowhere left to build. On maze levels the path is the route the flow field
+//              leads enemies along from the start tile, so the policy lines it with towers. It only ever submits commands that can succeed, so
+//              recorded replays stay small.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <vector>
+#include "Simulation.hpp"
+
+class ScriptedPolicy
+{
+public:
+	// The Nth tower built is buildOrder[N % buildOrder.size()]
+	explicit ScriptedPolicy(std::vector<TowerRegistry::Type> buildOrder = { TowerRegistry::Type::Bullet });
+
+	// Submits at most one command, meant to be called before every update
+	void submitCommands(Simulation& simulation) const;
+
+private:
+	std::vector<TowerRegistry::Type> buildOrder;
+};
@@ -0,0 +1,382 @@
+// ================================================================================================
+// File: Simulation.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 12, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "Simulation.hpp"
+#include "Utility.hpp"
+#include "Replay.hpp"
+#include "../entities/BulletTower.hpp"
+#include "../entities/SplashTower.hpp"
+#include "../entities/SlowTower.hpp"
+
+const float Simulation::FIXED_TIME_STEP = 1.f / 60.f;
+const int Simulation::TOWERS_PER_TASK = 32;
+
+Simulation::Simulation(int cols, int rows, std::uint64_t seed) :
+	cols(cols),
+	rows(rows),
+	balance(std::make_shared<const Balance>()),
+	nextBalance(balance),
+	nextPathingMode(Grid::PathingMode::Lane),
+	lives(balance->startingLives),
+	gold(std::make_shared<int>(balance->startingGold)),
+	rng(seed),
+	grid(cols, rows, rng),
+	timeBetweenWaves(balance->timeBetweenWaves),
+	timeSinceLastWaveEnded(balance->timeBetweenWaves),
+	timeBetweenEnemies(balance->timeBetweenEnemies),
+	timeSinceLastEnemySpawned(0.f),
+	wave(0),
+	enemiesPerWave(balance->enemyCount),
+	enemiesSpawnedThisWave(0),
+	waitingForFirstEnemyInWave(false),
+	recorder(nullptr),
+	profiler(nullptr),
+	tick(0)
+{
+	buildTowerStats();
+}
+
+void Simulation::submitCommand(const Command& command)
+{
+	pendingCommands.push_back(command);
+}
+
+void Simulation::update(float fixedTimeStep)
+{
+	events.clear();
+
+	for (const Command& command : pendingCommands)
+	{
+		if (recorder)
+			recorder->record(tick, command);
+		applyCommand(command);
+	}
+	pendingCommands.clear();
+
+	{
+		Profiler::ScopedTimer timer(profiler, Profiler::Section::UpdateWave);
+		updateWave(fixedTimeStep);
+	}
+
+	{
+		Profiler::ScopedTimer timer(profiler, Profiler::Section::EnemyUpdate);
+
+		if (grid.getPathingMode() == Grid::PathingMode::Maze)
+			enemies.update(fixedTimeStep, grid.getFlowField());
+		else
+			enemies.update(fixedTimeStep, grid.getPath());
+
+		for (int i = 0; i < enemies.size(); ++i)
+		{
+			if (enemies.hasReachedEnd(i))
+			{
+				lives--;
+				events.queueSound(SoundID::LIFE_LOST);
+			}
+		}
+
+		// Index enemies by their new positions so towers only need to look at nearby ones
+		enemyGrid.rebuild(enemies);
+	}
+
+	// Projectiles already in flight move and hit before towers fire new ones
+	{
+		Profiler::ScopedTimer timer(profiler, Profiler::Section::ProjectileUpdate);
+		projectiles.update(fixedTimeStep, enemies, enemyGrid, events);
+	}
+
+	// Towers pick their targets from the enemies as they were at the start of this phase, so the
+	// targetable enemies are indexed once for all towers. The shots are taken in tower order
+	// during the merge, where a tower whose target is already doomed by an earlier shot in this
+	// step picks another one.
+	const int taskCount = (static_cast<int>(towers.size()) + TOWERS_PER_TASK - 1) / TOWERS_PER_TASK;
+	if (static_cast<int>(towerIntents.size()) < taskCount)
+		towerIntents.resize(static_cast<size_t>(taskCount));
+
+	{
+		Profiler::ScopedTimer timer(profiler, Profiler::Section::TowerUpdate);
+		const EnemyPool& enemySnapshot = enemies;
+		bool isOrderNeeded = std::any_of(towers.begin(), towers.end(),
+			[](const std::shared_ptr<Tower>& tower) { return tower->getTargetingPolicy() != TargetIndex::Policy::Closest; });
+		targets.rebuild(enemySnapshot, grid.getPathingMode() == Grid::PathingMode::Lane ? &grid.getPath() : nullptr, isOrderNeeded);
+
+		workers.run(taskCount, [&](int task)
+			{
+				TowerIntents& intents = towerIntents[task];
+				intents.clear();
+
+				const int end = std::min(static_cast<int>(towers.size()), (task + 1) * TOWERS_PER_TASK);
+				for (int i = task * TOWERS_PER_TASK; i < end; ++i)
+					towers[i]->update(fixedTimeStep, enemySnapshot, enemyGrid, targets, intents);
+			});
+	}
+
+	{
+		Profiler::ScopedTimer timer(profiler, Profiler::Section::TowerMerge);
+		for (int task = 0; task < taskCount; ++task)
+			towerIntents[task].apply(enemies, enemyGrid, targets, projectiles, events);
+	}
+
+	for (auto& tower : towers)
+	{
+		if (tower->isMarkedForUpgrade())
+		{
+			if (tower->tryUpgrade(*gold))
+			{
+				*gold -= tower->getStats().buyCost;
+				events.queueSound(SoundID::TOWER_UPGRADE);
+			}
+		}
+		if (tower->isMarkedForSale())
+		{
+			grid.markTileAsBuildable(tower->getTilePosition());
+			*gold += tower->getStats().sellCost;
+			events.queueSound(SoundID::BUTTON_CLICK);
+		}
+	}
+
+	Profiler::ScopedTimer removeTimer(profiler, Profiler::Section::RemoveFinished);
+
+	// Remove towers that are sold
+	towers.erase(std::remove_if(towers.begin(), towers.end(),
+		[](const std::shared_ptr<Tower>& tower)
+		{
+			return tower->isMarkedForSale();
+		}),
+		towers.end()
+	);
+
+	// Enemies killed this step are paid out and removed right away; their deaths were reported
+	// in the events
+	for (int i = 0; i < enemies.size(); ++i)
+	{
+		if (enemies.isDead(i) && !enemies.hasReachedEnd(i))
+			*gold += enemies.getWorth(i);
+	}
+
+	// Remove enemies that have reached the end or are dead
+	enemies.removeFinished();
+
+	tick++;
+}
+
+void Simulation::updateEffects(float deltaTime)
+{
+	enemies.updateEffects(deltaTime);
+	projectiles.updateEffects(deltaTime);
+
+	for (auto& tower : towers)
+		tower->updateEffects(deltaTime);
+}
+
+void Simulation::reset(std::uint64_t seed)
+{
+	rng.seed(seed);
+
+	towers.clear();
+	balance = nextBalance;
+	buildTowerStats();
+	projectiles.clear();
+	enemies.clear();
+	events.clear();
+
+	timeBetweenWaves = balance->timeBetweenWaves;
+	timeSinceLastWaveEnded = balance->timeBetweenWaves;
+	timeBetweenEnemies = balance->timeBetweenEnemies;
+	timeSinceLastEnemySpawned = 0.f;
+	wave = 0;
+	enemiesPerWave = balance->enemyCount;
+	enemiesSpawnedThisWave = 0;
+	waitingForFirstEnemyInWave = false;
+	pendingCommands.clear();
+	tick = 0;
+
+	lives = balance->startingLives;
+	*gold = balance->startingGold;
+
+	grid.generateNewRandomLevel(cols, rows, rng, nextPathingMode);
+}
+
+void Simulation::reloadBalance(std::shared_ptr<const Balance> balance)
+{
+	this->balance = balance;
+	nextBalance = std::move(balance);
+
+	// The towers point into the old tables until they are re-pointed here
+	buildTowerStats();
+	for (auto& tower : towers)
+		tower->setLevels(towerStats[static_cast<int>(tower->getType())]);
+
+	timeBetweenWaves = this->balance->timeBetweenWaves;
+	timeBetweenEnemies = this->balance->timeBetweenEnemies + wave * this->balance->timeBetweenEnemiesPerWave;
+	enemiesPerWave = this->balance->enemyCount + wave * this->balance->enemyCountPerWave;
+}
+
+void Simulation::reset(std::uint64_t seed, sf::Vector2i mapSize)
+{
+	cols = mapSize.x;
+	rows = mapSize.y;
+	reset(seed);
+}
+
+void Simulation::reset()
+{
+	reset(Rng::makeRandomSeed());
+}
+
+void Simulation::applyCommand(const Command& command)
+{
+	switch (command.type)
+	{
+	case Command::Type::PlaceTower:
+	{
+		if (placeTower(command.towerType, command.tilePosition))
+			events.queueSound(SoundID::BUTTON_CLICK);
+		break;
+	}
+	case Command::Type::UpgradeTower:
+	{
+		if (std::shared_ptr<Tower> tower = getTowerAt(command.tilePosition))
+			tower->markForUpgrade();
+		break;
+	}
+	case Command::Type::SellTower:
+	{
+		if (std::shared_ptr<Tower> tower = getTowerAt(command.tilePosition))
+			tower->markForSale();
+		break;
+	}
+	case Command::Type::SetTargeting:
+	{
+		if (std::shared_ptr<Tower> tower = getTowerAt(command.tilePosition))
+			tower->setTargetingPolicy(command.targetingPolicy);
+		break;
+	}
+	}
+}
+
+bool Simulation::placeTower(TowerRegistry::Type type, sf::Vector2i tilePosition)
+{
+	if (type == TowerRegistry::Type::Count)
+		return false;
+	if (!canPlaceTower(tilePosition))
+		return false;
+	const std::vector<TowerRegistry::LevelStats>& levels = towerStats[static_cast<int>(type)];
+	if (*gold < levels.at(0).buyCost)
+		return false;
+
+	switch (type)
+	{
+	case TowerRegistry::Type::Bullet:
+	{
+		towers.push_back(std::make_shared<BulletTower>(tilePosition, levels));
+		break;
+	}
+	case TowerRegistry::Type::Splash:
+	{
+		towers.push_back(std::make_shared<SplashTower>(tilePosition, levels));
+		break;
+	}
+	case TowerRegistry::Type::Slow:
+	{
+		towers.push_back(std::make_shared<SlowTower>(tilePosition, levels));
+		break;
+	}
+	default:
+		return false;
+	}
+	*gold -= levels.at(0).buyCost;
+	grid.markTileAsTower(tilePosition);
+	return true;
+}
+
+bool Simulation::canPlaceTower(sf::Vector2i tilePosition) const
+{
+	// Tiles are marked as towers while a tower stands on them
+	if (grid.getTileType(tilePosition) != Tile::Type::Buildable)
+		return false;
+	if (grid.getPathingMode() != Grid::PathingMode::Maze)
+		return true;
+
+	// An enemy is on at most the tile it is in and the one it is walking to
+	std::vector<sf::Vector2i> occupiedTiles;
+	occupiedTiles.reserve(static_cast<std::size_t>(enemies.size()) * 2);
+	for (int i = 0; i < enemies.size(); ++i)
+	{
+		occupiedTiles.push_back(Utility::pixelToTilePosition(enemies.getPixelPosition(i)));
+		occupiedTiles.push_back(enemies.getTargetTile(i));
+	}
+
+	if (std::find(occupiedTiles.begin(), occupiedTiles.end(), tilePosition) != occupiedTiles.end())
+		return false;
+	return !grid.wouldBlockPath(tilePosition, occupiedTiles);
+}
+
+void Simulation::buildTowerStats()
+{
+	towerStats.assign(balance->towerAttributes.size(), {});
+	for (std::size_t type = 0; type < towerStats.size(); ++type)
+		for (const TowerRegistry::AttributesPerLevel& attributes : balance->towerAttributes[type])
+			towerStats[type].emplace_back(attributes);
+}
+
+std::shared_ptr<Tower> Simulation::getTowerAt(sf::Vector2i tilePosition) const
+{
+	auto towerAtTile = std::find_if(towers.begin(), towers.end(),
+		[tilePosition](const std::shared_ptr<Tower>& tower)
+		{
+			return tower->getTilePosition() == tilePosition;
+		});
+
+	return towerAtTile != towers.end() ? *towerAtTile : nullptr;
+}
+
+void Simulation::updateWave(float fixedTimeStep)
+{
+	timeSinceLastEnemySpawned += fixedTimeStep;
+
+	if (timeSinceLastWaveEnded >= timeBetweenWaves)
+	{
+		if (enemiesSpawnedThisWave == 0 && !waitingForFirstEnemyInWave)
+		{
+			events.queueSound(SoundID::NEW_WAVE);
+
+			wave++;
+			timeBetweenEnemies += balance->timeBetweenEnemiesPerWave;
+			enemiesPerWave += balance->enemyCountPerWave;
+
+			waitingForFirstEnemyInWave = true;
+		}
+
+		if (timeSinceLastEnemySpawned >= timeBetweenEnemies && enemiesSpawnedThisWave < enemiesPerWave)
+		{
+			waitingForFirstEnemyInWave = false;
+			timeSinceLastEnemySpawned = 0.f;
+			enemiesSpawnedThisWave++;
+
+			float speed = balance->enemySpeed + wave * balance->enemySpeedPerWave;
+			int health = static_cast<int>(balance->enemyHealth + wave * balance->enemyHealthPerWave);
+			if (grid.getPathingMode() == Grid::PathingMode::Maze)
+				enemies.spawn(grid.getStartTile(), grid.getFlowField(), speed, health);
+			else
+				enemies.spawn(grid.getPath(), speed, health);
+		}
+
+		if (enemiesSpawnedThisWave >= enemiesPerWave)
+		{
+			timeSinceLastWaveEnded = 0.f;
+			enemiesSpawnedThisWave = 0;
+		}
+	}
+	else
+	{
+		timeSinceLastWaveEnded += fixedTimeStep;
+	}
+}
@@ -0,0 +1,180 @@
+// ================================================================================================
+// File: Simulation.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 12, 2025
+// Description: Defines the Simulation class, which owns all gameplay state (grid, towers, enemies,
+//              wave progression, gold and lives) and advances it in fixed time steps.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Balance.hpp"
+#include "Grid.hpp"
+#include "Rng.hpp"
+#include "Profiler.hpp"
+#include "SimulationEvents.hpp"
+#include "SpatialHash.hpp"
+#include "TargetIndex.hpp"
+#include "WorkerPool.hpp"
+#include "../entities/EnemyPool.hpp"
+#include "../entities/ProjectilePool.hpp"
+#include "../entities/Tower.hpp"
+#include "../entities/TowerIntents.hpp"
+
+class Replay;
+
+class Simulation
+{
+public:
+	// A player action. These are the only inputs that change the simulation, so a game can be
+	// replayed from its seed and the commands it received.
+	struct Command
+	{
+		enum class Type : std::uint8_t
+		{
+			PlaceTower,
+			UpgradeTower,
+			SellTower,
+			SetTargeting
+		};
+		Type type;
+		sf::Vector2i tilePosition;
+		TowerRegistry::Type towerType = TowerRegistry::Type::Count; // Only used by PlaceTower
+		TargetIndex::Policy targetingPolicy = TargetIndex::Policy::Closest; // Only used by SetTargeting
+	};
+
+	Simulation(int cols, int rows, std::uint64_t seed = Rng::makeRandomSeed());
+
+	// Queues a command, which is applied at the start of the next update.
+	void submitCommand(const Command& command);
+
+	// Every applied command is recorded into the replay along with the tick it was applied on.
+	// Pass nullptr to stop recording. The replay must outlive the simulation or be detached first.
+	inline void setRecorder(Replay* replay) { recorder = replay; }
+
+	// Times each system of update() into the profiler. Pass nullptr (the default) to stop.
+	inline void setProfiler(Profiler* profiler) { this->profiler = profiler; }
+
+	// Number of worker threads used for the tower update, besides the calling thread. 0 updates
+	// towers on the calling thread only; the result is the same either way.
+	inline void setWorkerThreadCount(int threadCount) { workers.setThreadCount(threadCount); }
+	inline int getWorkerThreadCount() const { return workers.getThreadCount(); }
+
+	// The balance is shared read-only, so many simulations can play the same one. Towers are
+	// built from the tables of the balance the game was started with, so this takes effect
+	// from the next reset().
+	inline void setBalance(std::shared_ptr<const Balance> balance) { nextBalance = std::move(balance); }
+	// The balance of the game in progress
+	inline const Balance& getBalance() const { return *balance; }
+	// Switches to a new balance in the middle of a game, for tuning while it runs: built towers
+	// take on the new tables at their current level and the wave ramps are recalculated for the
+	// current wave. Lives and gold are left as they are.
+	void reloadBalance(std::shared_ptr<const Balance> balance);
+
+	// Whether the next reset() generates a lane level or a maze level
+	inline void setPathingMode(Grid::PathingMode pathingMode) { nextPathingMode = pathingMode; }
+	// The pathing mode of the level in play
+	inline Grid::PathingMode getPathingMode() const { return grid.getPathingMode(); }
+
+	// Advances the simulation by one fixed time step. What happened during it that only matters
+	// to the presentation can be read from getEvents() until the next update.
+	void update(float fixedTimeStep);
+	// Advances purely visual effects (damage flashes, explosions, pulses). They never affect the
+	// simulation, so when the game falls behind they can be stepped once per frame instead.
+	void updateEffects(float deltaTime);
+
+	// Resets all gameplay state and generates a new level from the given seed.
+	void reset(std::uint64_t seed);
+	// Same as above, with a level of a different size.
+	void reset(std::uint64_t seed, sf::Vector2i mapSize);
+	// Same as above, with a new random seed.
+	void reset();
+
+	// Returns the tower built on the given tile, or nullptr if there is none.
+	std::shared_ptr<Tower> getTowerAt(sf::Vector2i tilePosition) const;
+	// Whether a tower may be built on the tile, not counting its cost. On maze levels it also
+	// may not stand in an enemy's way or cut the start or any enemy off from the end.
+	bool canPlaceTower(sf::Vector2i tilePosition) const;
+
+	inline bool isGameOver() const { return lives <= 0; }
+	inline int getLives() const { return lives; }
+	inline int getGold() const { return *gold; }
+	inline const std::shared_ptr<int>& getGoldPointer() const { return gold; }
+	inline int getWave() const { return wave; }
+	inline unsigned long long getTick() const { return tick; }
+	inline std::uint64_t getSeed() const { return rng.getSeed(); }
+	inline sf::Vector2i getMapSize() const { return { cols, rows }; }
+
+	inline Grid& getGrid() { return grid; }
+	inline const Grid& getGrid() const { return grid; }
+	inline const std::vector<std::shared_ptr<Tower>>& getTowers() const { return towers; }
+	inline EnemyPool& getEnemies() { return enemies; }
+	inline const EnemyPool& getEnemies() const { return enemies; }
+	inline const ProjectilePool& getProjectiles() const { return projectiles; }
+	// Sounds and enemy deaths of the last update
+	inline const SimulationEvents& getEvents() const { return events; }
+	// Damage done to enemies by the given tower type this game, not counting overkill
+	inline long long getDamageDealt(TowerRegistry::Type type) const { return projectiles.getDamageDealt(type); }
+
+	static const float FIXED_TIME_STEP;
+	// Towers per parallel task. Fixed, so that the chunks (and the order their intents are
+	// applied in) never depend on the thread count.
+	static const int TOWERS_PER_TASK;
+
+private:
+	void updateWave(float fixedTimeStep);
+	void applyCommand(const Command& command);
+
+	// Builds a tower of the given type on a buildable tile if the player can afford it.
+	// Returns true if the tower was placed.
+	bool placeTower(TowerRegistry::Type type, sf::Vector2i tilePosition);
+	// Fills towerStats from the balance. Towers point into it, so they must be cleared or
+	// re-pointed right after.
+	void buildTowerStats();
+
+	int cols, rows;
+	std::shared_ptr<const Balance> balance;
+	std::shared_ptr<const Balance> nextBalance; // Becomes the balance on the next reset()
+	Grid::PathingMode nextPathingMode;
+	// The balance's tower tables with their derived values, indexed by type. Every tower points
+	// at the table of its type; it is only rebuilt in reset() and reloadBalance().
+	std::vector<std::vector<TowerRegistry::LevelStats>> towerStats;
+
+	int lives;
+	std::shared_ptr<int> gold;
+
+	// Declared before everything that draws from it during construction
+	Rng rng;
+
+	Grid grid;
+
+	std::vector<std::shared_ptr<Tower>> towers;
+	std::vector<TowerIntents> towerIntents; // One buffer per chunk of TOWERS_PER_TASK towers
+	WorkerPool workers;
+	ProjectilePool projectiles;
+	SimulationEvents events;
+
+	// Enemies
+	EnemyPool enemies;
+	SpatialHash enemyGrid;
+	TargetIndex targets;
+	float timeBetweenWaves;
+	float timeSinceLastWaveEnded;
+	float timeBetweenEnemies;
+	float timeSinceLastEnemySpawned;
+	int wave;
+	int enemiesPerWave;
+	int enemiesSpawnedThisWave;
+	bool waitingForFirstEnemyInWave;
+
+	std::vector<Command> pendingCommands;
+	Replay* recorder;
+	Profiler* profiler;
+
+	unsigned long long tick;
+};
@@ -0,0 +1,51 @@
+// ================================================================================================
+// File: SimulationEvents.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 27, 2025
+// Description: Defines the SimulationEvents class, a buffer of what happened during one fixed step
+//              that only the presentation cares about: sounds to play and enemies that died. The
+//              simulation fills it and never reads it back; the game drains it into the sound
+//              manager and the particle system after every step.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "../audio/SoundID.hpp"
+
+class SimulationEvents
+{
+public:
+	struct Sound
+	{
+		SoundID soundID;
+		float pitchVariancePercentage;
+	};
+
+	struct EnemyDeath
+	{
+		sf::Vector2f position;
+		std::uint8_t statusEffects; // The enemy's active status effects, which tint its death effect
+	};
+
+	inline void queueSound(SoundID soundID, float pitchVariancePercentage = 0.f) { sounds.push_back({ soundID, pitchVariancePercentage }); }
+	inline void addEnemyDeath(sf::Vector2f position, std::uint8_t statusEffects) { enemyDeaths.push_back({ position, statusEffects }); }
+
+	inline const std::vector<Sound>& getSounds() const { return sounds; }
+	inline const std::vector<EnemyDeath>& getEnemyDeaths() const { return enemyDeaths; }
+
+	inline void clear()
+	{
+		sounds.clear();
+		enemyDeaths.clear();
+	}
+
+private:
+	std::vector<Sound> sounds;
+	std::vector<EnemyDeath> enemyDeaths;
+};
@@ -0,0 +1,89 @@
+// ================================================================================================
+// File: SpatialHash.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 13, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <limits>
+#include "SpatialHash.hpp"
+
+SpatialHash::SpatialHash(float cellSize, std::size_t bucketCount) :
+	cellSize(cellSize),
+	bucketMask(bucketCount - 1),
+	occupiedMinCell(0, 0),
+	occupiedMaxCell(-1, -1),
+	bucketStarts(bucketCount + 1, 0)
+{}
+
+void SpatialHash::rebuild(const EnemyPool& enemies)
+{
+	const int enemyCount = enemies.size();
+	const float* positionsX = enemies.getPositionsX();
+	const float* positionsY = enemies.getPositionsY();
+
+	entryIndices.resize(enemyCount);
+	entryCells.resize(enemyCount);
+	entryPositionsX.resize(enemyCount);
+	entryPositionsY.resize(enemyCount);
+	enemyBuckets.resize(enemyCount);
+
+	occupiedMinCell = { std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+	occupiedMaxCell = { std::numeric_limits<int>::min(), std::numeric_limits<int>::min() };
+
+	// Count the enemies in each bucket
+	std::fill(bucketStarts.begin(), bucketStarts.end(), 0);
+	for (int i = 0; i < enemyCount; ++i)
+	{
+		sf::Vector2i cell = getCell({ positionsX[i], positionsY[i] });
+		enemyBuckets[i] = getBucket(cell);
+		bucketStarts[enemyBuckets[i] + 1]++;
+
+		occupiedMinCell = { std::min(occupiedMinCell.x, cell.x), std::min(occupiedMinCell.y, cell.y) };
+		occupiedMaxCell = { std::max(occupiedMaxCell.x, cell.x), std::max(occupiedMaxCell.y, cell.y) };
+	}
+
+	// Turn the counts into the start offset of each bucket
+	for (std::size_t bucket = 1; bucket < bucketStarts.size(); ++bucket)
+		bucketStarts[bucket] += bucketStarts[bucket - 1];
+
+	// Scatter the enemies into their buckets, keeping them in index order within each bucket
+	bucketCursors.assign(bucketStarts.begin(), bucketStarts.end() - 1);
+	for (int i = 0; i < enemyCount; ++i)
+	{
+		int entry = bucketCursors[enemyBuckets[i]]++;
+		entryIndices[entry] = i;
+		entryPositionsX[entry] = positionsX[i];
+		entryPositionsY[entry] = positionsY[i];
+		entryCells[entry] = getCell({ positionsX[i], positionsY[i] });
+	}
+}
+
+bool SpatialHash::isAnyInRadius(sf::Vector2f center, float radius, float radiusSquared) const
+{
+	if (entryIndices.empty())
+		return false;
+
+	sf::Vector2i minCell = getCell(center - sf::Vector2f(radius, radius));
+	sf::Vector2i maxCell = getCell(center + sf::Vector2f(radius, radius));
+	minCell = { std::max(minCell.x, occupiedMinCell.x), std::max(minCell.y, occupiedMinCell.y) };
+	maxCell = { std::min(maxCell.x, occupiedMaxCell.x), std::min(maxCell.y, occupiedMaxCell.y) };
+
+	// Entries of other cells that share a bucket are tested too: any enemy within the radius
+	// answers the question, whichever cell it was found through
+	for (int y = minCell.y; y <= maxCell.y; ++y)
+	{
+		for (int x = minCell.x; x <= maxCell.x; ++x)
+		{
+			std::size_t bucket = getBucket({ x, y });
+			int start = bucketStarts[bucket];
+			if (Geometry::isAnyWithinRadius(entryPositionsX.data() + start, entryPositionsY.data() + start,
+				bucketStarts[bucket + 1] - start, center, radiusSquared))
+				return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,197 @@
+// ================================================================================================
+// File: SpatialHash.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 13, 2025
+// Description: Defines the SpatialHash class, a uniform grid broadphase index over enemy positions.
+//              Enemies are bucketed by the tile-sized cell they are in, so towers and projectiles
+//              only test the enemies in nearby cells instead of scanning every enemy. The index is
+//              rebuilt once per fixed step, after enemies have moved.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "Geometry.hpp"
+#include "Grid.hpp"
+#include "../entities/EnemyPool.hpp"
+
+class SpatialHash
+{
+public:
+	// bucketCount must be a power of two
+	SpatialHash(float cellSize = Grid::TILE_SIZE, std::size_t bucketCount = 1024);
+
+	// Re-buckets all enemies by their current position. Indices reported by queries refer to the pool.
+	void rebuild(const EnemyPool& enemies);
+
+	// Calls visitor(index, distanceSquared) for every enemy within radius of the center.
+	template <typename Visitor>
+	void forEachInRadius(sf::Vector2f center, float radius, Visitor&& visitor) const;
+	// Same as above, with the squared radius already worked out
+	template <typename Visitor>
+	void forEachInRadius(sf::Vector2f center, float radius, float radiusSquared, Visitor&& visitor) const;
+
+	// Returns the index of the closest enemy within radius for which accept(index, distanceSquared)
+	// returns true, or -1 if there is none. Ties go to the enemy with the higher index.
+	template <typename Predicate>
+	int findNearest(sf::Vector2f center, float radius, Predicate&& accept) const;
+	// Same as above, with the squared radius already worked out
+	template <typename Predicate>
+	int findNearest(sf::Vector2f center, float radius, float radiusSquared, Predicate&& accept) const;
+
+	// Returns true if any enemy, dead or alive, is within radius of the center
+	bool isAnyInRadius(sf::Vector2f center, float radius, float radiusSquared) const;
+
+private:
+	inline sf::Vector2i getCell(sf::Vector2f position) const
+	{
+		return { static_cast<int>(std::floor(position.x / cellSize)), static_cast<int>(std::floor(position.y / cellSize)) };
+	}
+	inline std::size_t getBucket(sf::Vector2i cell) const
+	{
+		return ((static_cast<std::size_t>(cell.x) * 73856093u) ^ (static_cast<std::size_t>(cell.y) * 19349663u)) & bucketMask;
+	}
+
+	// Visits the entries of a single cell, skipping entries from other cells that share its bucket.
+	// The bucket's positions are tested with the Geometry kernels a chunk at a time.
+	template <typename Visitor>
+	void forEachInCell(sf::Vector2i cell, sf::Vector2f center, float radiusSquared, Visitor&& visitor) const;
+
+	float cellSize;
+	std::size_t bucketMask;
+
+	// Bounding box of all cells that contain at least one enemy
+	sf::Vector2i occupiedMinCell;
+	sf::Vector2i occupiedMaxCell;
+
+	// Entries are sorted by bucket; bucketStarts[b]..bucketStarts[b + 1] is the range of bucket b
+	std::vector<int> bucketStarts;
+	std::vector<int> entryIndices;
+	std::vector<sf::Vector2i> entryCells;
+	// Positions are split into x and y arrays for the Geometry kernels
+	std::vector<float> entryPositionsX;
+	std::vector<float> entryPositionsY;
+	std::vector<std::size_t> enemyBuckets;
+	std::vector<int> bucketCursors;
+
+	// Entries tested per call to the distance kernel; buckets rarely hold more than a few
+	static const int CHUNK_SIZE = 32;
+};
+
+template <typename Visitor>
+void SpatialHash::forEachInCell(sf::Vector2i cell, sf::Vector2f center, float radiusSquared, Visitor&& visitor) const
+{
+	std::size_t bucket = getBucket(cell);
+	const int end = bucketStarts[bucket + 1];
+
+	int hits[CHUNK_SIZE];
+	float hitDistancesSquared[CHUNK_SIZE];
+	for (int chunkStart = bucketStarts[bucket]; chunkStart < end; chunkStart += CHUNK_SIZE)
+	{
+		int hitCount = Geometry::findWithinRadius(entryPositionsX.data() + chunkStart, entryPositionsY.data() + chunkStart,
+			std::min(CHUNK_SIZE, end - chunkStart), center, radiusSquared, hits, hitDistancesSquared);
+
+		for (int hit = 0; hit < hitCount; ++hit)
+		{
+			int entry = chunkStart + hits[hit];
+			if (entryCells[entry] == cell)
+				visitor(entryIndices[entry], hitDistancesSquared[hit]);
+		}
+	}
+}
+
+template <typename Visitor>
+void SpatialHash::forEachInRadius(sf::Vector2f center, float radius, Visitor&& visitor) const
+{
+	forEachInRadius(center, radius, radius * radius, std::forward<Visitor>(visitor));
+}
+
+template <typename Visitor>
+void SpatialHash::forEachInRadius(sf::Vector2f center, float radius, float radiusSquared, Visitor&& visitor) const
+{
+	if (entryIndices.empty())
+		return;
+
+	// Only visit cells that can contain enemies
+	sf::Vector2i minCell = getCell(center - sf::Vector2f(radius, radius));
+	sf::Vector2i maxCell = getCell(center + sf::Vector2f(radius, radius));
+	minCell = { std::max(minCell.x, occupiedMinCell.x), std::max(minCell.y, occupiedMinCell.y) };
+	maxCell = { std::min(maxCell.x, occupiedMaxCell.x), std::min(maxCell.y, occupiedMaxCell.y) };
+
+	for (int y = minCell.y; y <= maxCell.y; ++y)
+		for (int x = minCell.x; x <= maxCell.x; ++x)
+			forEachInCell({ x, y }, center, radiusSquared, visitor);
+}
+
+template <typename Predicate>
+int SpatialHash::findNearest(sf::Vector2f center, float radius, Predicate&& accept) const
+{
+	return findNearest(center, radius, radius * radius, std::forward<Predicate>(accept));
+}
+
+template <typename Predicate>
+int SpatialHash::findNearest(sf::Vector2f center, float radius, float radiusSquared, Predicate&& accept) const
+{
+	if (entryIndices.empty())
+		return -1;
+
+	int nearestIndex = -1;
+	float nearestDistanceSquared = radiusSquared;
+
+	auto consider = [&](int index, float distanceSquared)
+		{
+			if (distanceSquared > nearestDistanceSquared || (distanceSquared == nearestDistanceSquared && index < nearestIndex))
+				return;
+			if (accept(index, distanceSquared))
+			{
+				nearestDistanceSquared = distanceSquared;
+				nearestIndex = index;
+			}
+		};
+
+	// Search outwards in square rings of cells around the center cell. Every cell in ring r + 1 is
+	// at least r cells away, so the search can stop as soon as a closer match has been found.
+	sf::Vector2i centerCell = getCell(center);
+	int maxRing = static_cast<int>(std::ceil(radius / cellSize)) + 1;
+
+	for (int ring = 0; ring <= maxRing; ++ring)
+	{
+		int top = centerCell.y - ring;
+		int bottom = centerCell.y + ring;
+		int left = centerCell.x - ring;
+		int right = centerCell.x + ring;
+
+		// Only visit the cells of the ring that can contain enemies
+		for (int y = std::max(top, occupiedMinCell.y); y <= std::min(bottom, occupiedMaxCell.y); ++y)
+		{
+			if (y == top || y == bottom)
+			{
+				for (int x = std::max(left, occupiedMinCell.x); x <= std::min(right, occupiedMaxCell.x); ++x)
+					forEachInCell({ x, y }, center, nearestDistanceSquared, consider);
+			}
+			else
+			{
+				if (left >= occupiedMinCell.x && left <= occupiedMaxCell.x)
+					forEachInCell({ left, y }, center, nearestDistanceSquared, consider);
+				if (right >= occupiedMinCell.x && right <= occupiedMaxCell.x)
+					forEachInCell({ right, y }, center, nearestDistanceSquared, consider);
+			}
+		}
+
+		float ringDistance = ring * cellSize;
+		if (nearestIndex != -1 && nearestDistanceSquared < ringDistance * ringDistance)
+			break;
+
+		// Stop once every occupied cell has been visited
+		if (left <= occupiedMinCell.x && right >= occupiedMaxCell.x && top <= occupiedMinCell.y && bottom >= occupiedMaxCell.y)
+			break;
+	}
+	return nearestIndex;
+}
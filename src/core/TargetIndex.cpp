@@ -0,0 +1,298 @@
+// ================================================================================================
+// File: TargetIndex.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "TargetIndex.hpp"
+#include "Utility.hpp"
+
+namespace
+{
+	// Far more than the rounding between an enemy's distance along the path and its position
+	const float SPAN_PADDING = 1.f;
+
+	// Largest level whose entries cover no more than length positions
+	int getTableLevel(int length)
+	{
+		int level = 0;
+		while ((2 << level) <= length)
+			level++;
+		return level;
+	}
+}
+
+TargetIndex::TargetIndex() :
+	enemies(nullptr),
+	path(nullptr)
+{}
+
+void TargetIndex::rebuild(const EnemyPool& enemies, const Path* path, bool isOrderNeeded)
+{
+	this->enemies = &enemies;
+	this->path = path;
+
+	sortedProgress.clear();
+	sortedEnemies.clear();
+	sortedHealth.clear();
+	strongestTable.clear();
+	weakestTable.clear();
+	if (!path || !isOrderNeeded)
+		return;
+
+	// The pool is in spawn order, which is mostly the reverse of the path order
+	sortScratch.clear();
+	for (int i = enemies.size() - 1; i >= 0; --i)
+	{
+		if (isTargetable(i))
+			sortScratch.push_back({ enemies.getDistanceAlongPath(i), i });
+	}
+	std::stable_sort(sortScratch.begin(), sortScratch.end(),
+		[](const std::pair<float, int>& a, const std::pair<float, int>& b) { return a.first < b.first; });
+
+	const int count = static_cast<int>(sortScratch.size());
+	for (const auto& [progress, index] : sortScratch)
+	{
+		sortedProgress.push_back(progress);
+		sortedEnemies.push_back(index);
+		sortedHealth.push_back(enemies.getHealth(index));
+	}
+
+	// Each level combines two halves from the level below
+	const int levels = count > 0 ? getTableLevel(count) + 1 : 0;
+	strongestTable.resize(static_cast<std::size_t>(levels) * count);
+	weakestTable.resize(static_cast<std::size_t>(levels) * count);
+	for (int i = 0; i < count; ++i)
+	{
+		strongestTable[i] = i;
+		weakestTable[i] = i;
+	}
+	for (int level = 1; level < levels; ++level)
+	{
+		const int half = 1 << (level - 1);
+		const int* previousStrongest = strongestTable.data() + (level - 1) * count;
+		const int* previousWeakest = weakestTable.data() + (level - 1) * count;
+		int* strongest = strongestTable.data() + level * count;
+		int* weakest = weakestTable.data() + level * count;
+
+		for (int i = 0; i + 2 * half <= count; ++i)
+		{
+			int a = previousStrongest[i], b = previousStrongest[i + half];
+			strongest[i] = isStronger(a, b) ? a : b;
+			a = previousWeakest[i];
+			b = previousWeakest[i + half];
+			weakest[i] = isWeaker(a, b) ? a : b;
+		}
+	}
+}
+
+void TargetIndex::findPathSpans(sf::Vector2f origin, float range, PathSpans& spans) const
+{
+	spans.clear();
+	if (!path)
+		return;
+
+	const std::vector<sf::Vector2f>& waypoints = path->getWaypoints();
+	const std::vector<float>& cumulativeLengths = path->getCumulativeLengths();
+
+	bool previousReachesEnd = false;
+	for (std::size_t segment = 0; segment + 1 < waypoints.size(); ++segment)
+	{
+		// Solve |start + t * direction - origin| = range for the distance t along the segment
+		sf::Vector2f start = waypoints[segment];
+		sf::Vector2f direction = Utility::normalize(waypoints[segment + 1] - start);
+		float length = cumulativeLengths[segment + 1] - cumulativeLengths[segment];
+
+		sf::Vector2f offset = start - origin;
+		float halfB = direction.x * offset.x + direction.y * offset.y;
+		float c = offset.x * offset.x + offset.y * offset.y - range * range;
+		float discriminant = halfB * halfB - c;
+		if (discriminant < 0.f)
+			continue;
+
+		float root = std::sqrt(discriminant);
+		float from = -halfB - root;
+		float to = -halfB + root;
+		if (from > length || to < 0.f)
+		{
+			previousReachesEnd = false;
+			continue;
+		}
+
+		// Padded so that no enemy in range is lost to rounding; the ones this lets in from just
+		// outside are trimmed off again when looking up a target
+		bool startsAtWaypoint = from <= 0.f;
+		bool reachesEnd = to >= length;
+		from = cumulativeLengths[segment] + std::max(from, 0.f) - SPAN_PADDING;
+		to = cumulativeLengths[segment] + std::min(to, length) + SPAN_PADDING;
+
+		// A stretch that carries on around a waypoint is one span
+		if (previousReachesEnd && startsAtWaypoint)
+			spans.back().second = to;
+		else
+			spans.push_back({ from, to });
+		previousReachesEnd = reachesEnd;
+	}
+
+	// Enemies past the end of the path stay on its last point until they are removed
+	if (!spans.empty() && spans.back().second >= path->getLength())
+		spans.back().second = std::numeric_limits<float>::max();
+}
+
+int TargetIndex::findTarget(Policy policy, sf::Vector2f origin, float range, float rangeSquared,
+	const PathSpans& spans, const SpatialHash& enemyGrid) const
+{
+	if (policy == Policy::Closest)
+		return enemyGrid.findNearest(origin, range, rangeSquared, [this](int index, float) { return isTargetable(index); });
+	if (!path)
+		return findTargetInRadius(policy, origin, range, rangeSquared, enemyGrid);
+	return findTargetOnPath(policy, origin, rangeSquared, spans);
+}
+
+const char* TargetIndex::getPolicyName(Policy policy)
+{
+	switch (policy)
+	{
+	case Policy::First:     return "First";
+	case Policy::Last:      return "Last";
+	case Policy::Strongest: return "Strongest";
+	case Policy::Weakest:   return "Weakest";
+	case Policy::Closest:   return "Closest";
+	default:                return "Unknown";
+	}
+}
+
+int TargetIndex::findTargetOnPath(Policy policy, sf::Vector2f origin, float rangeSquared, const PathSpans& spans) const
+{
+	auto isInRange = [&](int position)
+		{
+			sf::Vector2f offset = enemies->getPixelPosition(sortedEnemies[position]) - origin;
+			return offset.x * offset.x + offset.y * offset.y <= rangeSquared;
+		};
+
+	int best = -1;
+	for (const auto& [from, to] : spans)
+	{
+		int begin = static_cast<int>(std::lower_bound(sortedProgress.begin(), sortedProgress.end(), from) - sortedProgress.begin());
+		int end = static_cast<int>(std::upper_bound(sortedProgress.begin(), sortedProgress.end(), to) - sortedProgress.begin());
+
+		// Only the padded ends can hold enemies out of range, and in range is one stretch of a
+		// span, so the enemies left in between are all in range
+		while (begin < end && !isInRange(begin))
+			begin++;
+		while (begin < end && !isInRange(end - 1))
+			end--;
+		if (begin >= end)
+			continue;
+
+		// Enemies that shots taken earlier in this step will already kill are passed over
+		int candidate = -1;
+		bool isBetter = false;
+		switch (policy)
+		{
+		case Policy::First:
+			for (candidate = end - 1; candidate >= begin && !isTargetableAt(candidate); --candidate) {}
+			candidate = candidate >= begin ? candidate : -1;
+			isBetter = candidate > best;
+			break;
+		case Policy::Last:
+			for (candidate = begin; candidate < end && !isTargetableAt(candidate); ++candidate) {}
+			candidate = candidate < end ? candidate : -1;
+			isBetter = best == -1 || candidate < best;
+			break;
+		case Policy::Strongest:
+			candidate = findStrongest(begin, end);
+			isBetter = best == -1 || (candidate != -1 && isStronger(candidate, best));
+			break;
+		case Policy::Weakest:
+			candidate = findWeakest(begin, end);
+			isBetter = best == -1 || (candidate != -1 && isWeaker(candidate, best));
+			break;
+		default:
+			break;
+		}
+		if (candidate != -1 && isBetter)
+			best = candidate;
+	}
+	return best == -1 ? -1 : sortedEnemies[best];
+}
+
+int TargetIndex::findTargetInRadius(Policy policy, sf::Vector2f origin, float range, float rangeSquared, const SpatialHash& enemyGrid) const
+{
+	int best = -1;
+	enemyGrid.forEachInRadius(origin, range, rangeSquared,
+		[&](int index, float)
+		{
+			if (!isTargetable(index))
+				return;
+			if (best == -1)
+			{
+				best = index;
+				return;
+			}
+
+			float progress = enemies->getDistanceAlongPath(index);
+			float bestProgress = enemies->getDistanceAlongPath(best);
+			int health = enemies->getHealth(index);
+			int bestHealth = enemies->getHealth(best);
+			bool isBetter = false;
+			switch (policy)
+			{
+			case Policy::First:     isBetter = progress > bestProgress; break;
+			case Policy::Last:      isBetter = progress < bestProgress; break;
+			case Policy::Strongest: isBetter = health > bestHealth || (health == bestHealth && progress > bestProgress); break;
+			case Policy::Weakest:   isBetter = health < bestHealth || (health == bestHealth && progress > bestProgress); break;
+			default: break;
+			}
+			if (isBetter)
+				best = index;
+		});
+	return best;
+}
+
+int TargetIndex::findStrongest(int begin, int end) const
+{
+	const int count = static_cast<int>(sortedProgress.size());
+	const int level = getTableLevel(end - begin);
+	int a = strongestTable[level * count + begin];
+	int b = strongestTable[level * count + end - (1 << level)];
+	int strongest = isStronger(a, b) ? a : b;
+	if (isTargetableAt(strongest))
+		return strongest;
+
+	// The tables cannot leave out enemies doomed by earlier shots in this step, but there are few
+	// of those, so this only happens for the odd tower
+	strongest = -1;
+	for (int i = begin; i < end; ++i)
+	{
+		if (isTargetableAt(i) && (strongest == -1 || isStronger(i, strongest)))
+			strongest = i;
+	}
+	return strongest;
+}
+
+int TargetIndex::findWeakest(int begin, int end) const
+{
+	const int count = static_cast<int>(sortedProgress.size());
+	const int level = getTableLevel(end - begin);
+	int a = weakestTable[level * count + begin];
+	int b = weakestTable[level * count + end - (1 << level)];
+	int weakest = isWeaker(a, b) ? a : b;
+	if (isTargetableAt(weakest))
+		return weakest;
+
+	// As in findStrongest
+	weakest = -1;
+	for (int i = begin; i < end; ++i)
+	{
+		if (isTargetableAt(i) && (weakest == -1 || isWeaker(i, weakest)))
+			weakest = i;
+	}
+	return weakest;
+}
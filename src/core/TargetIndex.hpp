@@ -0,0 +1,93 @@
+// ================================================================================================
+// File: TargetIndex.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// Description: Defines the TargetIndex class, which picks the enemy a tower fires at according
+//              to the tower's targeting policy. It is rebuilt once per fixed step, right before
+//              the towers are updated. On lane levels the targetable enemies are then sorted by
+//              how far along the path they are, with range tables over their health.
+//              Enemies on a lane level are always on the path, so a tower's range covers a few
+//              fixed stretches of it. A lookup only binary searches those stretches in the sorted
+//              order and reads the first, last, strongest or weakest enemy of each, without
+//              visiting the enemies in between. Closest targeting, and every policy on maze
+//              levels, queries the spatial hash instead.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "Path.hpp"
+#include "SpatialHash.hpp"
+#include "../entities/EnemyPool.hpp"
+
+class TargetIndex
+{
+public:
+	enum class Policy : std::uint8_t
+	{
+		First,     // Furthest along the path
+		Last,      // Least far along the path
+		Strongest, // Most health left
+		Weakest,   // Least health left
+		Closest,   // Closest to the tower
+		Count
+	};
+
+	// Stretches of the path within a tower's range, as distances along it from and to
+	using PathSpans = std::vector<std::pair<float, float>>;
+
+	TargetIndex();
+
+	// Indexes the targetable enemies of the pool. Only their incoming damage may change until the
+	// next rebuild; lookups skip the enemies it makes untargetable. The path is that of a lane
+	// level, or nullptr on maze levels. Sorting along the path is
+	// skipped unless isOrderNeeded, which it only is for towers with a policy other than Closest.
+	void rebuild(const EnemyPool& enemies, const Path* path, bool isOrderNeeded);
+
+	// Finds the stretches of the path within range of the origin. They only depend on the path
+	// and the range, so towers work them out once and keep them. Empty on maze levels.
+	void findPathSpans(sf::Vector2f origin, float range, PathSpans& spans) const;
+
+	// Returns the index of the enemy in range that the policy prefers, or -1 if there is none.
+	// The spans must have been found for the same origin and range.
+	int findTarget(Policy policy, sf::Vector2f origin, float range, float rangeSquared,
+		const PathSpans& spans, const SpatialHash& enemyGrid) const;
+
+	// Whether an enemy is alive and not already taken care of by incoming damage
+	inline bool isTargetable(int index) const { return enemies->getHealth(index) - enemies->getIncomingDamage(index) > 0; }
+
+	static const char* getPolicyName(Policy policy);
+
+private:
+	int findTargetOnPath(Policy policy, sf::Vector2f origin, float rangeSquared, const PathSpans& spans) const;
+	int findTargetInRadius(Policy policy, sf::Vector2f origin, float range, float rangeSquared, const SpatialHash& enemyGrid) const;
+
+	// Position in the sorted order of the targetable enemy the policy prefers among the sorted
+	// positions [begin, end), read from the range tables, or -1 if there is none
+	int findStrongest(int begin, int end) const;
+	int findWeakest(int begin, int end) const;
+	inline bool isTargetableAt(int position) const { return isTargetable(sortedEnemies[position]); }
+	// Whether the enemy at sorted position a is preferred over the one at b; ties go to the one
+	// further along the path
+	inline bool isStronger(int a, int b) const { return sortedHealth[a] > sortedHealth[b] || (sortedHealth[a] == sortedHealth[b] && a > b); }
+	inline bool isWeaker(int a, int b) const { return sortedHealth[a] < sortedHealth[b] || (sortedHealth[a] == sortedHealth[b] && a > b); }
+
+	const EnemyPool* enemies;
+	const Path* path;
+
+	// Targetable enemies sorted by distance along the path, least far first (lane levels only)
+	std::vector<float> sortedProgress;
+	std::vector<int> sortedEnemies;
+	std::vector<int> sortedHealth;
+	// Entry [level * count + i] is the sorted position of the strongest (weakest) enemy among the
+	// 2^level positions starting at i, so any range is covered by two overlapping entries
+	std::vector<int> strongestTable;
+	std::vector<int> weakestTable;
+	std::vector<std::pair<float, int>> sortScratch;
+};
@@ -2,9 +2,9 @@
 // File: Tile.hpp
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: April 28, 2025
-// Description: Defines the Tile class, which represents a single tile on the game grid. Each tile
-//              holds information about its position, size, and whether it is occupied. It is 
-//              visually represented by an SFML RectangleShape for rendering.
+// Description: Defines the Tile namespace. A tile on the game grid is stored as nothing more than
+//              its type, one byte; its position follows from where it is in the grid, and its look
+//              is derived from the type and position when the grid is drawn.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -12,13 +12,11 @@
 
 #pragma once
 
-#include <memory>
-#include <SFML/Graphics.hpp>
+#include <cstdint>
 
-class Tile
+namespace Tile
 {
-public:
-	enum class Type
+	enum class Type : std::uint8_t
 	{
 		Start,
 		End,
@@ -27,20 +25,4 @@ public:
 		Tower,
 		Unassigned
 	};
-
-	Tile(Type type, int x, int y, float size);
-
-	void render(float interpolationFactor, sf::RenderWindow& window);
-
-	Type getType() const { return type; }
-	void markAsTower() { type = Type::Tower; }
-
-	bool isSelected;
-
-private:
-	Type type;
-	int x, y;
-	float size;
-
-	sf::RectangleShape shape;
-};
\ No newline at end of file
+}
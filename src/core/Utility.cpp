@@ -9,35 +9,14 @@
 
 #include <iostream>
 #include <sstream>
-#include <random>
-#include <map>
 #include <cmath>
 #include "Utility.hpp"
+#include "Rng.hpp"
 #include "Grid.hpp"
 
-float Utility::randomNumber(float min, float max)
+float Utility::randomPitch(Rng& rng, float variationPercent)
 {
-	static std::random_device rd;
-	static std::mt19937 gen(rd());
-	std::uniform_real_distribution<float> dis(min, max);
-	return dis(gen);
-}
-
-int Utility::randomNumber(int min, int max)
-{
-	static std::random_device rd;
-	static std::mt19937 gen(rd());
-	std::uniform_int_distribution<int> dis(min, max);
-	return dis(gen);
-}
-
-float Utility::randomPitch(float variationPercent)
-{
-	static std::random_device rd;
-	static std::mt19937 gen(rd());
-	static std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
-
-	float randomFactor = dist(gen);
+	float randomFactor = rng.range(-0.5f, 0.5f);
 	return 1.0f + randomFactor * 2.0f * variationPercent;
 }
 
@@ -97,56 +76,6 @@ std::optional<sf::Vector2f> Utility::predictTargetIntercept(
 	return targetPosition + targetVelocity * t;
 }
 
-Enemy* Utility::getClosestEnemyInRange(
-	sf::Vector2f origin,
-	std::vector<Enemy>& enemies,
-	float range,
-	bool dontOverkill)
-{
-	Enemy* closestEnemy = nullptr;
-	float closestDistanceSq = range * range;
-
-	for (auto& enemy : enemies)
-	{
-		// Skip dead enemies
-		if (enemy.isDead())
-			continue;
-
-		if (dontOverkill)
-		{
-			int effectiveHealth = enemy.getHealth() - enemy.getIncomingDamage();
-			if (effectiveHealth <= 0)
-				continue;
-		}
-
-		float distanceSq = Utility::distanceSquared(origin, enemy.getPixelPosition());
-		if (distanceSq <= closestDistanceSq)
-		{
-			closestDistanceSq = distanceSq;
-			closestEnemy = &enemy;
-		}
-	}
-	return closestEnemy;
-}
-
-sf::Color Utility::blendColors(sf::Color base, sf::Color overlay)
-{
-	float alpha = overlay.a / 255.f;
-
-	auto blendChannel = [&](std::uint8_t baseChannel, std::uint8_t overlayChannel) 
-	{
-		return static_cast<std::uint8_t>(baseChannel * (1.f - alpha) + overlayChannel * alpha);
-	};
-
-	return sf::Color
-	(
-		blendChannel(base.r, overlay.r),
-		blendChannel(base.g, overlay.g),
-		blendChannel(base.b, overlay.b),
-		255
-	);
-}
-
 sf::Vector2f Utility::tileToPixelPosition(int col, int row, bool getCenterOfTile)
 {
 	if (getCenterOfTile)
@@ -162,29 +91,8 @@ sf::Vector2f Utility::tileToPixelPosition(sf::Vector2i tilePosition, bool getCen
 
 sf::Vector2i Utility::pixelToTilePosition(sf::Vector2f pixelPosition)
 {
-	return { static_cast<int>(pixelPosition.x / Grid::TILE_SIZE), static_cast<int>(pixelPosition.y / Grid::TILE_SIZE) };
-}
-
-bool Utility::isMouseButtonReleased(sf::Mouse::Button button)
-{
-	static std::map<sf::Mouse::Button, bool> buttonStates;
-	if (buttonStates.find(button) == buttonStates.end())
-		buttonStates[button] = false;
-	bool isPressedNow = sf::Mouse::isButtonPressed(button);
-	bool wasPressedLastFrame = buttonStates[button];
-	buttonStates[button] = isPressedNow;
-	return !isPressedNow && wasPressedLastFrame;
-}
-
-bool Utility::isKeyReleased(sf::Keyboard::Key key)
-{
-	static std::map<sf::Keyboard::Key, bool> keyStates;
-	if (keyStates.find(key) == keyStates.end())
-		keyStates[key] = false;
-	bool isPressedNow = sf::Keyboard::isKeyPressed(key);
-	bool wasPressedLastFrame = keyStates[key];
-	keyStates[key] = isPressedNow;
-	return !isPressedNow && wasPressedLastFrame;
+	// Floored, so positions left of or above the grid do not round towards the first tile
+	return { static_cast<int>(std::floor(pixelPosition.x / Grid::TILE_SIZE)), static_cast<int>(std::floor(pixelPosition.y / Grid::TILE_SIZE)) };
 }
 
 std::string Utility::removeTrailingZeros(float number)
@@ -199,3 +107,25 @@ std::string Utility::removeTrailingZeros(float number)
 		str.pop_back();
 	return str;
 }
+
+std::optional<sf::Vector2i> Utility::parseMapSize(const std::string& text)
+{
+	std::istringstream ss(text);
+	int cols = 0, rows = 0;
+	char separator = 0;
+	if (!(ss >> cols >> separator >> rows) || separator != 'x' || !ss.eof() || !isValidMapSize(cols, rows))
+		return std::nullopt;
+	return sf::Vector2i(cols, rows);
+}
+
+bool Utility::isValidMapSize(int cols, int rows)
+{
+	// The path never runs along the first and last rows, so it needs at least one row in between,
+	// and it needs a few columns to turn in to reach every row (see Grid::generateNewRandomLevel)
+	if (cols < 5 || rows < 3)
+		return false;
+
+	// Far beyond anything playable, but keeps the tile count well inside an int
+	const int MAX_SIDE = 4096;
+	return cols <= MAX_SIDE && rows <= MAX_SIDE;
+}
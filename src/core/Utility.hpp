@@ -12,21 +12,17 @@
 
 #pragma once
 
+#include <cmath>
 #include <optional>
+#include <string>
 #include <SFML/System/Vector2.hpp>
-#include <SFML/Window/Keyboard.hpp>
-#include <SFML/Window/Mouse.hpp>
-#include <SFML/Graphics/Color.hpp>
-#include "../entities/Enemy.hpp"
+class Rng;
 
 namespace Utility
 {
-	float randomNumber(float min, float max);
-	int randomNumber(int min, int max);
-
 	// Generates a random pitch value based on a given variation percentage.
 	// Example use: variationPercent 0.15f == 15% variation
-	float randomPitch(float variationPercent);
+	float randomPitch(Rng& rng, float variationPercent);
 
 	// Interpolates between two vectors based on a factor (0.0 to 1.0).
 	sf::Vector2f interpolate(sf::Vector2f previous, sf::Vector2f current, float factor);
@@ -51,25 +47,17 @@ namespace Utility
 		sf::Vector2f targetVelocity,
 		float projectileSpeed);
 
-	// Returns a pointer to the closest enemy within a specified range from the origin.
-	// If dontOverkill is true (default), it will only consider enemies that are not about
-	// to die (checks enemies for incoming damage).
-	Enemy* getClosestEnemyInRange(
-		sf::Vector2f origin,
-		std::vector<Enemy>& enemies,
-		float range,
-		bool dontOverkill = true);
-
-	// Blends two colors based on the alpha value of the overlay color.
-	sf::Color blendColors(sf::Color base, sf::Color overlay);
-
 	sf::Vector2f tileToPixelPosition(int col, int row, bool getCenterOfTile = true);
 	sf::Vector2f tileToPixelPosition(sf::Vector2i, bool getCenterOfTile = true);
 	sf::Vector2i pixelToTilePosition(sf::Vector2f pixelPosition);
 
-	bool isMouseButtonReleased(sf::Mouse::Button button);
-	bool isKeyReleased(sf::Keyboard::Key key);
-
 	// Removes trailing zeros from a float and returns it as a string.
 	std::string removeTrailingZeros(float number);
+
+	// Whether a level can be generated on a map of this many tiles.
+	bool isValidMapSize(int cols, int rows);
+
+	// Parses a map size given as "COLSxROWS", e.g. "200x150".
+	// Returns std::nullopt if it is malformed or not a valid map size.
+	std::optional<sf::Vector2i> parseMapSize(const std::string& text);
 }
\ No newline at end of file
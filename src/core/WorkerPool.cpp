@@ -0,0 +1,126 @@
+// ================================================================================================
+// File: WorkerPool.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 21, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "WorkerPool.hpp"
+
+WorkerPool::WorkerPool(int threadCount) :
+	threadCount(std::max(0, threadCount)),
+	currentTask(nullptr),
+	taskCount(0),
+	nextTask(0),
+	finishedWorkers(0),
+	generation(0),
+	isStopping(false)
+{}
+
+WorkerPool::~WorkerPool()
+{
+	stop();
+}
+
+void WorkerPool::run(int taskCount, const std::function<void(int)>& task)
+{
+	if (taskCount <= 0)
+		return;
+
+	// Waking the workers costs more than a single task is worth
+	if (threadCount == 0 || taskCount == 1)
+	{
+		for (int i = 0; i < taskCount; ++i)
+			task(i);
+		return;
+	}
+	if (threads.empty())
+		start();
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		currentTask = &task;
+		this->taskCount = taskCount;
+		nextTask = 0;
+		finishedWorkers = 0;
+		generation++;
+	}
+	wakeCondition.notify_all();
+
+	runTasks();
+
+	// Every worker has to check in, so none of them can still be looking at this batch later
+	std::unique_lock<std::mutex> lock(mutex);
+	doneCondition.wait(lock, [this] { return finishedWorkers == static_cast<int>(threads.size()); });
+	currentTask = nullptr;
+}
+
+void WorkerPool::setThreadCount(int threadCount)
+{
+	threadCount = std::max(0, threadCount);
+	if (threadCount == this->threadCount)
+		return;
+
+	// The next batch starts the new number of threads
+	stop();
+	this->threadCount = threadCount;
+}
+
+int WorkerPool::getDefaultThreadCount()
+{
+	return std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+}
+
+void WorkerPool::start()
+{
+	isStopping = false;
+	threads.reserve(static_cast<size_t>(threadCount));
+	// Workers start from the current generation rather than reading it once they are running, or
+	// one starting after the next run() has begun would miss that batch and never check in
+	for (int i = 0; i < threadCount; ++i)
+		threads.emplace_back(&WorkerPool::workerLoop, this, generation);
+}
+
+void WorkerPool::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+	wakeCondition.notify_all();
+
+	for (std::thread& thread : threads)
+		thread.join();
+	threads.clear();
+}
+
+void WorkerPool::workerLoop(std::uint64_t seenGeneration)
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wakeCondition.wait(lock, [&] { return isStopping || generation != seenGeneration; });
+			if (isStopping)
+				return;
+			seenGeneration = generation;
+		}
+
+		runTasks();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			finishedWorkers++;
+		}
+		doneCondition.notify_one();
+	}
+}
+
+void WorkerPool::runTasks()
+{
+	for (int i = nextTask.fetch_add(1); i < taskCount; i = nextTask.fetch_add(1))
+		(*currentTask)(i);
+}
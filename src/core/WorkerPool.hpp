@@ -0,0 +1,63 @@
+// ================================================================================================
+// File: WorkerPool.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 21, 2025
+// Description: Defines the WorkerPool class, a small set of persistent threads that run a batch of
+//              indexed tasks together with the calling thread. run() hands out task indices until
+//              all are taken and only returns once every worker has finished the batch, so the
+//              tasks may safely reference state on the caller's stack. The threads are only started
+//              by the first batch that needs them.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool
+{
+public:
+	// With 0 threads every batch runs on the calling thread
+	explicit WorkerPool(int threadCount = getDefaultThreadCount());
+	~WorkerPool();
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	// Calls task(i) for every i in [0, taskCount), in no particular order and on any thread
+	void run(int taskCount, const std::function<void(int)>& task);
+
+	void setThreadCount(int threadCount);
+	inline int getThreadCount() const { return threadCount; }
+
+	// One worker per hardware thread, leaving one for the calling thread
+	static int getDefaultThreadCount();
+
+private:
+	void start();
+	void stop();
+	void workerLoop(std::uint64_t seenGeneration);
+	void runTasks();
+
+	int threadCount;
+	std::vector<std::thread> threads; // Empty until the first batch that runs on more than one thread
+
+	std::mutex mutex;
+	std::condition_variable wakeCondition;
+	std::condition_variable doneCondition;
+
+	// State of the current batch, written under the mutex before the generation is advanced
+	const std::function<void(int)>* currentTask;
+	int taskCount;
+	std::atomic<int> nextTask;
+	int finishedWorkers;
+	std::uint64_t generation;
+	bool isStopping;
+};
@@ -15,13 +15,15 @@
 class BulletTower : public Tower
 {
 public:
-	BulletTower(sf::Vector2i tilePosition);
+	BulletTower(sf::Vector2i tilePosition, const std::vector<TowerRegistry::LevelStats>& levels);
 	BulletTower(const BulletTower&) = default;
 	BulletTower& operator=(const BulletTower&) = default;
 
-	void update(float fixedTimeStep, std::vector<Enemy>& enemies, SoundManager& soundManager) override;
-	void render(float interpolationFactor, sf::RenderWindow& window) override;
+	void update(float fixedTimeStep, const EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets, TowerIntents& intents) override;
 
 private:
-	void fireAt(sf::Vector2f target) override;
+	void fireAt(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, ProjectilePool& projectiles,
+		SimulationEvents& events) override;
+
+	const float MAX_BULLET_DISTANCE = 2000.f;
 };
\ No newline at end of file
@@ -0,0 +1,302 @@
+// ================================================================================================
+// File: EnemyPool.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 14, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "EnemyPool.hpp"
+#include "../core/Grid.hpp"
+#include "../core/Utility.hpp"
+
+const float EnemyPool::BASE_SPEED = 60.f;
+const int EnemyPool::BASE_HEALTH = 5;
+const float EnemyPool::SIZE = 15.f;
+
+EnemyPool::EnemyPool() :
+	damageFlashDuration(0.1f)
+{}
+
+void EnemyPool::spawn(const Path& path, float speed, int health)
+{
+	add(path.getPositionAt(0.f), path.getDirectionAt(0.f), 0.f, { 0, 0 }, speed, health);
+}
+
+void EnemyPool::spawn(sf::Vector2i startTile, const FlowField& flowField, float speed, int health)
+{
+	sf::Vector2f position = Utility::tileToPixelPosition(startTile.x - 1, startTile.y);
+	sf::Vector2i exitTile = flowField.getGoal() + sf::Vector2i(1, 0);
+	add(position, { 1.f, 0.f }, -getRemainingDistance(position, startTile, exitTile, flowField), startTile, speed, health);
+}
+
+void EnemyPool::add(sf::Vector2f position, sf::Vector2f direction, float distanceAlongPath, sf::Vector2i targetTile, float speed, int health)
+{
+	this->distanceAlongPath.push_back(distanceAlongPath);
+	positionX.push_back(position.x);
+	positionY.push_back(position.y);
+	previousX.push_back(position.x);
+	previousY.push_back(position.y);
+	directionX.push_back(direction.x);
+	directionY.push_back(direction.y);
+	targetTileX.push_back(targetTile.x);
+	targetTileY.push_back(targetTile.y);
+	baseSpeed.push_back(speed);
+	currentSpeed.push_back(speed);
+	this->health.push_back(health);
+	incomingDamage.push_back(0);
+	flags.push_back(0);
+	statusEffects.emplace_back();
+
+	float rawValue = health * 0.6f + speed * 0.4f;
+	worth.push_back(std::clamp(static_cast<int>(rawValue / 30.f), 1, 15));
+
+	renderStates.emplace_back();
+}
+
+void EnemyPool::update(float fixedTimeStep, const Path& path)
+{
+	const float pathLength = path.getLength();
+
+	for (int i = 0; i < size(); ++i)
+	{
+		updateStatusEffects(i, fixedTimeStep);
+		incomingDamage[i] = 0;
+
+		// Advance along the path and derive the new position from it
+		distanceAlongPath[i] += currentSpeed[i] * fixedTimeStep;
+
+		sf::Vector2f position = path.getPositionAt(distanceAlongPath[i]);
+		sf::Vector2f direction = path.getDirectionAt(distanceAlongPath[i]);
+		previousX[i] = positionX[i];
+		previousY[i] = positionY[i];
+		positionX[i] = position.x;
+		positionY[i] = position.y;
+		directionX[i] = direction.x;
+		directionY[i] = direction.y;
+
+		if (distanceAlongPath[i] >= pathLength)
+			flags[i] |= HAS_REACHED_END;
+	}
+}
+
+void EnemyPool::update(float fixedTimeStep, const FlowField& flowField)
+{
+	// Enemies leave one tile past the end tile, which is always in the last column
+	const sf::Vector2i goalTile = flowField.getGoal();
+	const sf::Vector2i exitTile = goalTile + sf::Vector2i(1, 0);
+
+	for (int i = 0; i < size(); ++i)
+	{
+		updateStatusEffects(i, fixedTimeStep);
+		incomingDamage[i] = 0;
+
+		previousX[i] = positionX[i];
+		previousY[i] = positionY[i];
+
+		// Walk straight from tile centre to tile centre, so enemies never cut across the corner
+		// of a tower. Placing towers on target tiles is not allowed, so the way is always open.
+		sf::Vector2f position(positionX[i], positionY[i]);
+		sf::Vector2i targetTile(targetTileX[i], targetTileY[i]);
+		float step = currentSpeed[i] * fixedTimeStep;
+		while (step > 0.f)
+		{
+			sf::Vector2f target = Utility::tileToPixelPosition(targetTile);
+			float distance = Utility::distance(position, target);
+			if (distance > step)
+			{
+				sf::Vector2f direction = (target - position) / distance;
+				position += direction * step;
+				directionX[i] = direction.x;
+				directionY[i] = direction.y;
+				break;
+			}
+
+			position = target;
+			step -= distance;
+			if (targetTile == exitTile)
+			{
+				flags[i] |= HAS_REACHED_END;
+				break;
+			}
+
+			sf::Vector2i nextTile = (targetTile == goalTile) ? exitTile : flowField.getNextTile(targetTile);
+			if (nextTile == targetTile)
+				break; // Cut off from the end; wait here until a tower is sold
+			targetTile = nextTile;
+		}
+
+		positionX[i] = position.x;
+		positionY[i] = position.y;
+		targetTileX[i] = targetTile.x;
+		targetTileY[i] = targetTile.y;
+		distanceAlongPath[i] = -getRemainingDistance(position, targetTile, exitTile, flowField);
+	}
+}
+
+void EnemyPool::updateEffects(float deltaTime)
+{
+	for (auto& renderState : renderStates)
+	{
+		// Update damage flash effect
+		if (renderState.damageFlashTimer > 0.f)
+		{
+			renderState.damageFlashTimer -= deltaTime;
+			if (renderState.damageFlashTimer < 0.f)
+				renderState.damageFlashTimer = 0.f;
+		}
+	}
+}
+
+void EnemyPool::removeFinished()
+{
+	int kept = 0;
+	for (int i = 0; i < size(); ++i)
+	{
+		if ((flags[i] & HAS_REACHED_END) || isDead(i))
+			continue;
+
+		if (kept != i)
+		{
+			distanceAlongPath[kept] = distanceAlongPath[i];
+			positionX[kept] = positionX[i];
+			positionY[kept] = positionY[i];
+			previousX[kept] = previousX[i];
+			previousY[kept] = previousY[i];
+			directionX[kept] = directionX[i];
+			directionY[kept] = directionY[i];
+			targetTileX[kept] = targetTileX[i];
+			targetTileY[kept] = targetTileY[i];
+			baseSpeed[kept] = baseSpeed[i];
+			currentSpeed[kept] = currentSpeed[i];
+			health[kept] = health[i];
+			incomingDamage[kept] = incomingDamage[i];
+			worth[kept] = worth[i];
+			flags[kept] = flags[i];
+			statusEffects[kept] = statusEffects[i];
+			renderStates[kept] = std::move(renderStates[i]);
+		}
+		kept++;
+	}
+
+	distanceAlongPath.resize(kept);
+	positionX.resize(kept);
+	positionY.resize(kept);
+	previousX.resize(kept);
+	previousY.resize(kept);
+	directionX.resize(kept);
+	directionY.resize(kept);
+	targetTileX.resize(kept);
+	targetTileY.resize(kept);
+	baseSpeed.resize(kept);
+	currentSpeed.resize(kept);
+	health.resize(kept);
+	incomingDamage.resize(kept);
+	worth.resize(kept);
+	flags.resize(kept);
+	statusEffects.resize(kept);
+	renderStates.resize(kept);
+}
+
+void EnemyPool::clear()
+{
+	distanceAlongPath.clear();
+	positionX.clear();
+	positionY.clear();
+	previousX.clear();
+	previousY.clear();
+	directionX.clear();
+	directionY.clear();
+	targetTileX.clear();
+	targetTileY.clear();
+	baseSpeed.clear();
+	currentSpeed.clear();
+	health.clear();
+	incomingDamage.clear();
+	worth.clear();
+	flags.clear();
+	statusEffects.clear();
+	renderStates.clear();
+}
+
+void EnemyPool::applyStatusEffect(int index, const StatusEffect& effect)
+{
+	StatusEffects& effects = statusEffects[index];
+	const int type = static_cast<int>(effect.type);
+
+	// Reapplying an effect that is already active replaces it and restarts its timer
+	effects.slots[type] = effect;
+	effects.activeMask |= 1 << type;
+
+	applyStatusEffectModifiers(index);
+}
+
+bool EnemyPool::takeDamage(int index, int damage)
+{
+	// Already dead enemies stay in the pool until the end of the step and may still be hit
+	if (health[index] <= 0)
+		return false;
+
+	health[index] = std::max(health[index] - damage, 0);
+	renderStates[index].damageFlashTimer = damageFlashDuration;
+	return health[index] == 0;
+}
+
+float EnemyPool::getRemainingDistance(sf::Vector2f position, sf::Vector2i targetTile, sf::Vector2i exitTile, const FlowField& flowField)
+{
+	float distance = Utility::distance(position, Utility::tileToPixelPosition(targetTile));
+	if (targetTile != exitTile)
+		distance += (static_cast<float>(flowField.getDistance(targetTile)) + 1.f) * Grid::TILE_SIZE;
+	return distance;
+}
+
+void EnemyPool::updateStatusEffects(int index, float fixedTimeStep)
+{
+	StatusEffects& effects = statusEffects[index];
+	if (effects.activeMask == 0)
+		return;
+
+	bool hasExpired = false;
+	for (int type = 0; type < StatusEffects::TYPE_COUNT; ++type)
+	{
+		if (!(effects.activeMask & (1 << type)))
+			continue;
+
+		StatusEffect& effect = effects.slots[type];
+		effect.timer += fixedTimeStep;
+		if (effect.timer >= effect.duration)
+		{
+			effects.activeMask &= ~(1 << type);
+			hasExpired = true;
+		}
+	}
+
+	if (hasExpired)
+		applyStatusEffectModifiers(index);
+}
+
+void EnemyPool::applyStatusEffectModifiers(int index)
+{
+	const StatusEffects& effects = statusEffects[index];
+	float slowFactor = 1.f;
+
+	for (int type = 0; type < StatusEffects::TYPE_COUNT; ++type)
+	{
+		if (!(effects.activeMask & (1 << type)))
+			continue;
+
+		const StatusEffect& effect = effects.slots[type];
+		switch (effect.type)
+		{
+		case StatusEffect::Type::Slow:
+			slowFactor = std::min(slowFactor, 1.f - effect.amount);
+			break;
+		default:
+			break;
+		}
+	}
+
+	currentSpeed[index] = baseSpeed[index] * slowFactor;
+}
@@ -0,0 +1,147 @@
+// ================================================================================================
+// File: EnemyPool.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 14, 2025
+// Description: Defines the EnemyPool class, which stores every enemy unit in the game as a
+//              structure of arrays. Enemies are referred to by their index, which stays valid
+//              until removeFinished().
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "../core/FlowField.hpp"
+#include "../core/Path.hpp"
+
+class EnemyPool
+{
+public:
+	struct StatusEffect
+	{
+		// New types go before Count; each enemy has one slot per type
+		enum class Type
+		{
+			Slow,
+			Count
+		};
+		StatusEffect() = default;
+		inline StatusEffect(StatusEffect::Type type, float amount, float duration) :
+			type(type),
+			amount(amount),
+			duration(duration)
+		{}
+		Type type = Type::Slow;
+		float amount = 0.f;   // e.g., 0.5 for -50% speed
+		float duration = 0.f; // in seconds
+		float timer = 0.f;
+	};
+
+	EnemyPool();
+
+	// Spawns an enemy at the start of a lane level's path
+	void spawn(const Path& path, float speed, int health);
+	// Spawns an enemy one tile off the grid next to a maze level's start tile
+	void spawn(sf::Vector2i startTile, const FlowField& flowField, float speed, int health);
+	// On lane levels an enemy only tracks how far along the path it is, and its position is
+	// derived from that
+	void update(float fixedTimeStep, const Path& path);
+	// On maze levels an enemy walks from tile centre to tile centre, asking the flow field for the
+	// next tile each time it reaches one
+	void update(float fixedTimeStep, const FlowField& flowField);
+	// Advances render-only state (damage flashes). Nothing the simulation reads depends on it, so it may be stepped more coarsely than update().
+	void updateEffects(float deltaTime);
+
+	// Removes enemies that have reached the end or are dead, keeping the rest in spawn order.
+	void removeFinished();
+	void clear();
+
+	void applyStatusEffect(int index, const StatusEffect& effect);
+	// Returns true if the damage killed the enemy
+	bool takeDamage(int index, int damage);
+	// Damage already on its way from shots taken this step; cleared when the enemies next move
+	inline void addIncomingDamage(int index, int dmg) { incomingDamage[index] += dmg; }
+
+	inline int size() const { return static_cast<int>(health.size()); }
+	inline bool empty() const { return health.empty(); }
+
+	inline bool isDead(int index) const { return health[index] <= 0; }
+	inline bool hasReachedEnd(int index) const { return flags[index] & HAS_REACHED_END; }
+	inline int getHealth(int index) const { return health[index]; }
+	inline int getIncomingDamage(int index) const { return incomingDamage[index]; }
+	inline int getWorth(int index) const { return worth[index]; }
+	inline sf::Vector2f getPixelPosition(int index) const { return { positionX[index], positionY[index] }; }
+	// Position before the last update, for interpolating between the two when rendering
+	inline sf::Vector2f getPreviousPixelPosition(int index) const { return { previousX[index], previousY[index] }; }
+	inline sf::Vector2f getVelocity(int index) const { return { directionX[index] * currentSpeed[index], directionY[index] * currentSpeed[index] }; }
+	// How far along the path the enemy is; the enemy with the highest value is the closest to the end.
+	// On maze levels this is minus the distance the enemy still has to walk.
+	inline float getDistanceAlongPath(int index) const { return distanceAlongPath[index]; }
+	// The tile a maze level enemy is walking to
+	inline sf::Vector2i getTargetTile(int index) const { return { targetTileX[index], targetTileY[index] }; }
+	// One bit per active StatusEffect::Type
+	inline std::uint8_t getActiveStatusEffects(int index) const { return statusEffects[index].activeMask; }
+	// 1 right after the enemy was hit, fading to 0
+	inline float getDamageFlash(int index) const { return renderStates[index].damageFlashTimer / damageFlashDuration; }
+
+	// Contiguous position arrays, indexed like the enemies themselves
+	inline const float* getPositionsX() const { return positionX.data(); }
+	inline const float* getPositionsY() const { return positionY.data(); }
+
+	static const float BASE_SPEED;
+	static const int BASE_HEALTH;
+	static const float SIZE;
+
+private:
+	enum Flags : std::uint8_t
+	{
+		HAS_REACHED_END = 1 << 0
+	};
+
+	// Every effect an enemy can have at once, one slot per type; only slots whose bit is set
+	// in activeMask hold a live effect
+	struct StatusEffects
+	{
+		static const int TYPE_COUNT = static_cast<int>(StatusEffect::Type::Count);
+		static_assert(TYPE_COUNT <= 8, "activeMask has one bit per status effect type");
+
+		std::array<StatusEffect, TYPE_COUNT> slots;
+		std::uint8_t activeMask = 0;
+	};
+
+	void add(sf::Vector2f position, sf::Vector2f direction, float distanceAlongPath, sf::Vector2i targetTile, float speed, int health);
+	// Distance left to walk from the position through the target tile to the exit of a maze level
+	static float getRemainingDistance(sf::Vector2f position, sf::Vector2i targetTile, sf::Vector2i exitTile, const FlowField& flowField);
+
+	void updateStatusEffects(int index, float fixedTimeStep);
+	// Derives the enemy's current speed from its active status effects
+	void applyStatusEffectModifiers(int index);
+
+	// Simulation state
+	std::vector<float> distanceAlongPath;
+	std::vector<float> positionX, positionY;
+	std::vector<float> previousX, previousY;
+	std::vector<float> directionX, directionY;
+	std::vector<int> targetTileX, targetTileY; // Only used on maze levels
+	std::vector<float> baseSpeed;
+	std::vector<float> currentSpeed;
+	std::vector<int> health;
+	std::vector<int> incomingDamage;
+	std::vector<int> worth;
+	std::vector<std::uint8_t> flags;
+	std::vector<StatusEffects> statusEffects;
+
+	// Render-only state
+	struct RenderState
+	{
+		float damageFlashTimer = 0.f;
+	};
+	std::vector<RenderState> renderStates;
+
+	const float damageFlashDuration;
+};
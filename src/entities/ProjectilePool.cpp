@@ -0,0 +1,154 @@
+// ================================================================================================
+// File: ProjectilePool.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 17, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "ProjectilePool.hpp"
+#include "../core/Utility.hpp"
+
+const int ProjectilePool::CAPACITY = 2048;
+const float ProjectilePool::EXPLOSION_DURATION = 0.3f;
+
+ProjectilePool::ProjectilePool() :
+	projectiles(CAPACITY),
+	slotHighWaterMark(0)
+{
+	for (auto& projectile : projectiles)
+		projectile.isActive = false;
+
+	// Slots are handed out from the back of the free list, lowest index first
+	freeSlots.reserve(CAPACITY);
+	for (int slot = CAPACITY - 1; slot >= 0; --slot)
+		freeSlots.push_back(slot);
+
+	explosions.reserve(64);
+	damageDealt.fill(0);
+}
+
+bool ProjectilePool::spawn(TowerRegistry::Type type, sf::Vector2f origin, sf::Vector2f direction, float speed,
+	float maxDistance, int damage, float splashRadius)
+{
+	if (freeSlots.empty())
+		return false;
+
+	int slot = freeSlots.back();
+	freeSlots.pop_back();
+	slotHighWaterMark = std::max(slotHighWaterMark, slot + 1);
+
+	Projectile& projectile = projectiles[slot];
+	projectile.positionCurrent = origin;
+	projectile.positionPrevious = origin;
+	projectile.direction = direction;
+	projectile.origin = origin;
+	projectile.speed = speed;
+	projectile.maxDistanceSquared = maxDistance * maxDistance;
+	projectile.splashRadius = splashRadius;
+	projectile.damage = damage;
+	projectile.type = type;
+	projectile.isActive = true;
+	projectile.hasHit = false;
+	return true;
+}
+
+void ProjectilePool::update(float fixedTimeStep, EnemyPool& enemies, const SpatialHash& enemyGrid, SimulationEvents& events)
+{
+	for (int slot = 0; slot < slotHighWaterMark; ++slot)
+	{
+		Projectile& projectile = projectiles[slot];
+		if (!projectile.isActive)
+			continue;
+
+		// Release projectiles that hit something last step (deferred by 1 frame for smooth interpolation)
+		if (projectile.hasHit)
+		{
+			release(slot);
+			continue;
+		}
+
+		projectile.positionPrevious = projectile.positionCurrent;
+		projectile.positionCurrent += projectile.direction * projectile.speed * fixedTimeStep;
+
+		// Splash projectiles explode when they reach their maximum distance, others just vanish
+		if (Utility::distanceSquared(projectile.positionCurrent, projectile.origin) >= projectile.maxDistanceSquared)
+		{
+			if (projectile.splashRadius > 0.f)
+			{
+				explodeAt(projectile, enemies, enemyGrid, events);
+				events.queueSound(SoundID::SPLASH_EXPLODE, 0.1f);
+			}
+			projectile.hasHit = true;
+			continue;
+		}
+
+		// Enemies killed earlier this step are still in the grid but no longer stop projectiles
+		int hitIndex = enemyGrid.findNearest(projectile.positionCurrent, EnemyPool::SIZE,
+			[&](int index, float) { return !enemies.isDead(index); });
+
+		if (hitIndex != -1)
+		{
+			if (projectile.splashRadius > 0.f)
+			{
+				explodeAt(projectile, enemies, enemyGrid, events);
+				events.queueSound(SoundID::SPLASH_EXPLODE, 0.1f);
+			}
+			else
+			{
+				damageEnemy(hitIndex, projectile, enemies, events);
+				events.queueSound(SoundID::ENEMY_HIT, 0.15f);
+			}
+			projectile.hasHit = true;
+		}
+	}
+}
+
+void ProjectilePool::updateEffects(float deltaTime)
+{
+	// Update explosion timers; radius and fade are derived from the timer when rendering
+	for (auto& explosion : explosions)
+		explosion.timer += deltaTime;
+
+	explosions.erase(std::remove_if(explosions.begin(), explosions.end(),
+		[this](const Explosion& explosion) { return explosion.timer >= EXPLOSION_DURATION; }), explosions.end());
+}
+
+void ProjectilePool::clear()
+{
+	for (int slot = 0; slot < slotHighWaterMark; ++slot)
+		projectiles[slot].isActive = false;
+
+	freeSlots.clear();
+	for (int slot = CAPACITY - 1; slot >= 0; --slot)
+		freeSlots.push_back(slot);
+	slotHighWaterMark = 0;
+
+	explosions.clear();
+	damageDealt.fill(0);
+}
+
+void ProjectilePool::release(int slot)
+{
+	projectiles[slot].isActive = false;
+	freeSlots.push_back(slot);
+}
+
+void ProjectilePool::damageEnemy(int index, const Projectile& projectile, EnemyPool& enemies, SimulationEvents& events)
+{
+	damageDealt[static_cast<int>(projectile.type)] += std::min(projectile.damage, enemies.getHealth(index));
+	if (enemies.takeDamage(index, projectile.damage))
+		events.addEnemyDeath(enemies.getPixelPosition(index), enemies.getActiveStatusEffects(index));
+}
+
+void ProjectilePool::explodeAt(const Projectile& projectile, EnemyPool& enemies, const SpatialHash& enemyGrid, SimulationEvents& events)
+{
+	enemyGrid.forEachInRadius(projectile.positionCurrent, projectile.splashRadius,
+		[&](int index, float)
+		{
+			damageEnemy(index, projectile, enemies, events);
+		});
+	explosions.push_back({ projectile.positionCurrent, projectile.splashRadius, 0.f });
+}
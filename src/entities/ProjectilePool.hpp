@@ -0,0 +1,98 @@
+// ================================================================================================
+// File: ProjectilePool.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 17, 2025
+// Description: Defines the ProjectilePool class, a fixed-capacity pool holding every projectile
+//              fired by any tower, along with the explosions they leave behind. Projectiles are
+//              plain records; the game derives their look from the firing tower's type.
+//              Free slots are recycled through a free list, so firing never allocates, and all
+//              projectiles are moved and tested against enemies in a single pass per fixed step.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "TowerRegistry.hpp"
+#include "EnemyPool.hpp"
+#include "../core/SimulationEvents.hpp"
+#include "../core/SpatialHash.hpp"
+
+class ProjectilePool
+{
+public:
+	struct Projectile
+	{
+		sf::Vector2f positionCurrent;
+		sf::Vector2f positionPrevious;
+		sf::Vector2f direction;
+		sf::Vector2f origin;
+		float speed;
+		float maxDistanceSquared;
+		float splashRadius;
+		int damage;
+		TowerRegistry::Type type;
+		bool isActive;
+		bool hasHit; // Released on the next update, so the impact position still gets rendered
+	};
+
+	struct Explosion
+	{
+		sf::Vector2f position;
+		float radius;
+		float timer;
+	};
+
+	ProjectilePool();
+
+	// Fires a projectile from origin in the given direction. A projectile with a splash radius
+	// explodes on impact or once it has travelled maxDistance; others simply disappear there.
+	// Returns false if the pool is full and the shot was dropped.
+	bool spawn(TowerRegistry::Type type, sf::Vector2f origin, sf::Vector2f direction, float speed,
+		float maxDistance, int damage, float splashRadius = 0.f);
+
+	// Moves all projectiles and applies damage to the enemies they hit. Hits and kills are
+	// reported in the events.
+	void update(float fixedTimeStep, EnemyPool& enemies, const SpatialHash& enemyGrid, SimulationEvents& events);
+	// Advances the explosions, which are only visual
+	void updateEffects(float deltaTime);
+
+	void clear();
+
+	// Calls fn(projectile) for every projectile in flight
+	template<typename Function>
+	void forEachActive(Function&& fn) const
+	{
+		for (int slot = 0; slot < slotHighWaterMark; ++slot)
+		{
+			if (projectiles[slot].isActive)
+				fn(projectiles[slot]);
+		}
+	}
+	inline const std::vector<Explosion>& getExplosions() const { return explosions; }
+
+	inline int getActiveCount() const { return CAPACITY - static_cast<int>(freeSlots.size()); }
+	// Damage done to enemies by projectiles of the given tower type since the last clear(),
+	// not counting damage beyond an enemy's remaining health
+	inline long long getDamageDealt(TowerRegistry::Type type) const { return damageDealt[static_cast<int>(type)]; }
+
+	static const int CAPACITY;
+	static const float EXPLOSION_DURATION;
+
+private:
+	void release(int slot);
+	void damageEnemy(int index, const Projectile& projectile, EnemyPool& enemies, SimulationEvents& events);
+	void explodeAt(const Projectile& projectile, EnemyPool& enemies, const SpatialHash& enemyGrid, SimulationEvents& events);
+
+	std::vector<Projectile> projectiles;
+	std::vector<int> freeSlots;
+	int slotHighWaterMark; // No slot at or above this index has ever been handed out
+
+	std::vector<Explosion> explosions;
+
+	std::array<long long, static_cast<int>(TowerRegistry::Type::Count)> damageDealt;
+};
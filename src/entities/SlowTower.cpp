@@ -7,98 +7,57 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <algorithm>
 #include "SlowTower.hpp"
 
-SlowTower::SlowTower(sf::Vector2i tilePosition) :
-	Tower(TowerRegistry::Type::Slow, sf::Color(8, 60, 86), sf::Color(9, 66, 96), sf::Color(10, 73, 106), tilePosition),
-	effectOverlayColor(sf::Color(54, 139, 193, 123)),
-	isPulsing(false),
-	pulseTimer(0.f)
+SlowTower::SlowTower(sf::Vector2i tilePosition, const std::vector<TowerRegistry::LevelStats>& levels) :
+	Tower(TowerRegistry::Type::Slow, tilePosition, levels),
+	pulseTimer(0.f),
+	isPulsing(false)
 {}
 
-void SlowTower::update(float fixedTimeStep, std::vector<Enemy>& enemies, SoundManager& soundManager)
+void SlowTower::update(float fixedTimeStep, const EnemyPool&, const SpatialHash& enemyGrid, const TargetIndex&, TowerIntents& intents)
 {
 	timeSinceLastShot += fixedTimeStep;
 
-	updateSelectionOutline();
-
 	// Check if there are any enemies in range
-	bool enemiesInRange = false;
-	for (const auto& enemy : enemies)
-	{
-		if (Utility::distance(enemy.getPixelPosition(), position) <= attributes.at(level).range)
-		{
-			enemiesInRange = true;
-			break; // No need to check further if at least one enemy is in range
-		}
-	}
+	bool enemiesInRange = enemyGrid.isAnyInRadius(position, stats->range, stats->rangeSquared);
 
-	if (enemiesInRange && timeSinceLastShot >= attributes.at(level).fireRate)
+	if (enemiesInRange && canFire())
 	{
-		soundManager.playSound(SoundManager::SoundID::SLOW_PULSE, 0.1f);
+		intents.queueSound(SoundID::SLOW_PULSE, 0.1f);
 
 		timeSinceLastShot = 0.f;
 		
 		isPulsing = true;
 		pulseTimer = 0.f;
-		pulseCircle.setRadius(0.f);
-		pulseCircle.setFillColor(effectOverlayColor);
-		pulseCircle.setOrigin({ pulseCircle.getRadius(), pulseCircle.getRadius() });
-		pulseCircle.setPosition(position);
 
-		for (auto& enemy : enemies)
-		{
-			if (Utility::distance(enemy.getPixelPosition(), position) <= attributes.at(level).range)
+		enemyGrid.forEachInRadius(position, stats->range, stats->rangeSquared,
+			[&](int index, float)
 			{
-				enemy.applyStatusEffect(
+				intents.applyStatusEffect(index,
 					{
-						Enemy::StatusEffect::Type::Slow,
-						effectOverlayColor,
-						attributes.at(level).slowAmount,
-						attributes.at(level).slowDuration
+						EnemyPool::StatusEffect::Type::Slow,
+						stats->slowAmount,
+						stats->slowDuration
 					});
-			}
-		}
+			});
 	}
+}
 
+void SlowTower::updateEffects(float deltaTime)
+{
 	if (isPulsing)
 	{
-		pulseTimer += fixedTimeStep;
-		float t = pulseTimer / PULSE_DURATION;
-		float radius = attributes.at(level).range * t;
-		pulseCircle.setRadius(radius);
-		pulseCircle.setOrigin({ radius, radius });
-		pulseCircle.setPosition(position);
-
-		int alpha = static_cast<int>((1.f - t) * effectOverlayColor.a); // Fade out
-		pulseCircle.setFillColor(sf::Color(effectOverlayColor.r, effectOverlayColor.g, effectOverlayColor.b, alpha));
-
+		pulseTimer += deltaTime;
 		if (pulseTimer >= PULSE_DURATION)
 			isPulsing = false;
 	}
 }
 
-void SlowTower::render(float interpolationFactor, sf::RenderWindow& window)
-{
-	if (isPulsing)
-		window.draw(pulseCircle);
-
-	if (isRangeCircleVisible)
-		window.draw(rangeCircle);
-
-	window.draw(shape);
-	if (level > 0)
-		window.draw(shape2);
-	if (level > 1)
-		window.draw(shape3);
-}
-
-void SlowTower::fireAt(sf::Vector2f target)
+void SlowTower::fireAt(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, ProjectilePool& projectiles,
+	SimulationEvents& events)
 {
 	/*isPulsing = true;
-	pulseTimer = 0.f;
-	pulseCircle.setRadius(0.f);
-	pulseCircle.setFillColor(effectOverlayColor);
-	pulseCircle.setOrigin({ pulseCircle.getRadius(), pulseCircle.getRadius() });
-	pulseCircle.setPosition(position);*/
+	pulseTimer = 0.f;*/
 }
\ No newline at end of file
@@ -10,25 +10,28 @@
 
 #pragma once
 
+#include <algorithm>
 #include "Tower.hpp"
 
 class SlowTower : public Tower
 {
 public:
-	SlowTower(sf::Vector2i tilePosition);
+	SlowTower(sf::Vector2i tilePosition, const std::vector<TowerRegistry::LevelStats>& levels);
 	SlowTower(const SlowTower&) = default;
 	SlowTower& operator=(const SlowTower&) = default;
 
-	void update(float fixedTimeStep, std::vector<Enemy>& enemies, SoundManager& soundManager) override;
-	void render(float interpolationFactor, sf::RenderWindow& window) override;
+	void update(float fixedTimeStep, const EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets, TowerIntents& intents) override;
+	void updateEffects(float deltaTime) override;
+
+	// How far the pulse has spread, from 0 when fired to 1 at the edge of the range, or -1 if
+	// the tower is not pulsing
+	inline float getPulseProgress() const { return isPulsing ? std::min(pulseTimer / PULSE_DURATION, 1.f) : -1.f; }
 
 private:
-	void fireAt(sf::Vector2f target) override;
+	void fireAt(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, ProjectilePool& projectiles,
+		SimulationEvents& events) override;
 
 	const float PULSE_DURATION = 0.3f;
 	float pulseTimer;
 	bool isPulsing;
-	sf::CircleShape pulseCircle;
-
-	sf::Color effectOverlayColor;
 };
\ No newline at end of file
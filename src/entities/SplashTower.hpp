@@ -15,20 +15,13 @@
 class SplashTower : public Tower
 {
 public:
-	SplashTower(sf::Vector2i tilePosition);
+	SplashTower(sf::Vector2i tilePosition, const std::vector<TowerRegistry::LevelStats>& levels);
 	SplashTower(const SplashTower&) = default;
 	SplashTower& operator=(const SplashTower&) = default;
 
-	void update(float fixedTimeStep, std::vector<Enemy>& enemies, SoundManager& soundManager) override;
-	void render(float interpolationFactor, sf::RenderWindow& window) override;
+	void update(float fixedTimeStep, const EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets, TowerIntents& intents) override;
 
 private:
-	void fireAt(sf::Vector2f target) override;
-	void explodeAt(sf::Vector2f location, std::vector<Enemy>& enemies);
-		
-	std::vector<sf::CircleShape> explosions;
-	std::vector<float> explosionTimers;
-
-	const float EXPLOSION_DURATION = 0.3f;
-	sf::Color explosionColor;
+	void fireAt(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, ProjectilePool& projectiles,
+		SimulationEvents& events) override;
 };
\ No newline at end of file
@@ -9,75 +9,63 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <algorithm>
 #include "Tower.hpp"
 
-Tower::Tower(TowerRegistry::Type type, sf::Color color, sf::Color color2, sf::Color color3, sf::Vector2i tilePosition) :
+Tower::Tower(TowerRegistry::Type type, sf::Vector2i tilePosition, const std::vector<TowerRegistry::LevelStats>& levels) :
 	isSelected(false),
-	type(type),
-	towerColor(color),
+	bulletSpeed(0.f),
+	levels(&levels),
+	stats(&levels.at(0)),
 	position(Utility::tileToPixelPosition(tilePosition)),
+	type(type),
 	timeSinceLastShot(0.f),
-	bulletSpeed(0.f),
+	targetingPolicy(TargetIndex::Policy::Closest),
+	rangeOnPathRadius(-1.f),
 	level(0),
+	m_isRangeCircleVisible(false),
 	m_isMarkedForSale(false),
-	m_isMarkedForUpgrade(false),
-	isRangeCircleVisible(false)
-{
-	// Fetch the tower metadata attributes from the registry
-	const TowerRegistry::TowerMetadata& metadata = TowerRegistry::getTowerMetadataRegistry()[static_cast<int>(type)];
-	attributes = metadata.attributes;
-
-	shape.setSize({ 80.f, 80.f });
-	shape.setFillColor(towerColor);
-	shape.setOrigin({ shape.getSize().x / 2.f, shape.getSize().y / 2.f });
-	shape.setPosition(position);
-
-	shape2.setSize({ 60.f, 60.f });
-	shape2.setFillColor(color2);
-	shape2.setOrigin({ shape2.getSize().x / 2.f, shape2.getSize().y / 2.f });
-	shape2.setPosition(position);
-
-	shape3.setSize({ 40.f, 40.f });
-	shape3.setFillColor(color3);
-	shape3.setOrigin({ shape3.getSize().x / 2.f, shape3.getSize().y / 2.f });
-	shape3.setPosition(position);
-
-	rangeCircle.setRadius(attributes.at(level).range);
-	rangeCircle.setOrigin({ rangeCircle.getRadius(), rangeCircle.getRadius() });
-	rangeCircle.setFillColor(sf::Color(0, 0, 0, 15));
-	rangeCircle.setOutlineColor(sf::Color(0, 0, 0, 50));
-	rangeCircle.setOutlineThickness(2.f);
-	rangeCircle.setPosition(position);
-	rangeCircle.setPointCount(100);
-}
+	m_isMarkedForUpgrade(false)
+{}
 
 bool Tower::tryUpgrade(int gold)
 {
 	if (level >= getMaxLevel())
 		return false;
 
-	if (gold >= attributes.at(static_cast<size_t>(level + 1)).buyCost)
+	const TowerRegistry::LevelStats& nextLevel = (*levels)[static_cast<size_t>(level + 1)];
+	if (gold >= nextLevel.buyCost)
 	{
 		level++;
-		rangeCircle.setRadius(attributes.at(level).range);
-		rangeCircle.setOrigin({ rangeCircle.getRadius(), rangeCircle.getRadius() });
-		rangeCircle.setPosition(position);
+		stats = &nextLevel;
 		m_isMarkedForUpgrade = false;
 		return true;
 	}
 	return false;
 }
 
-void Tower::updateSelectionOutline()
+void Tower::setLevels(const std::vector<TowerRegistry::LevelStats>& levels)
 {
-	if (isSelected)
-	{
-		shape.setOutlineColor(sf::Color(255, 255, 255, 255));
-		shape.setOutlineThickness(4.f);
-	}
-	else
+	this->levels = &levels;
+	level = std::min(level, getMaxLevel());
+	stats = &levels.at(static_cast<size_t>(level));
+}
+
+int Tower::findTarget(const SpatialHash& enemyGrid, const TargetIndex& targets)
+{
+	if (rangeOnPathRadius != stats->range)
 	{
-		shape.setOutlineColor(sf::Color(0, 0, 0, 0));
-		shape.setOutlineThickness(0.f);
+		targets.findPathSpans(position, stats->range, rangeOnPath);
+		rangeOnPathRadius = stats->range;
 	}
-}
\ No newline at end of file
+	return targets.findTarget(targetingPolicy, position, stats->range, stats->rangeSquared, rangeOnPath, enemyGrid);
+}
+
+void Tower::takeShot(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets,
+	ProjectilePool& projectiles, SimulationEvents& events)
+{
+	if (!targets.isTargetable(target))
+		target = findTarget(enemyGrid, targets);
+	if (target != -1)
+		fireAt(target, enemies, enemyGrid, projectiles, events);
+}
@@ -11,75 +11,90 @@
 
 #pragma once
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
 #include "../core/Utility.hpp"
+#include "../core/SpatialHash.hpp"
+#include "../core/TargetIndex.hpp"
 #include "TowerRegistry.hpp"
-#include "Enemy.hpp"
-#include "../audio/SoundManager.hpp"
+#include "EnemyPool.hpp"
+#include "TowerIntents.hpp"
+#include "../core/SimulationEvents.hpp"
 
 class Tower
 {
 public:
-	Tower(TowerRegistry::Type type, sf::Color color, sf::Color color2, sf::Color color3, sf::Vector2i tilePosition);
+	// The levels are the tower's stats per level, shared by every tower of its type. They are not
+	// copied, so they must outlive the tower (or be replaced with setLevels first).
+	Tower(TowerRegistry::Type type, sf::Vector2i tilePosition, const std::vector<TowerRegistry::LevelStats>& levels);
 	Tower(const Tower&) = default;
 	Tower& operator=(const Tower&) = default;
 	virtual ~Tower() = default;
 
-	virtual void update(float fixedTimeStep, std::vector<Enemy>& enemies, SoundManager& soundManager) = 0;
-	virtual void render(float interpolationFactor, sf::RenderWindow& window) = 0;
+	// The enemy grid and the target index are rebuilt from the enemy pool once per fixed step,
+	// before towers are updated. Towers may be updated in parallel, so they only read the enemies
+	// and record what they want to change (shots, status effects, sounds) in the intents buffer.
+	virtual void update(float fixedTimeStep, const EnemyPool& enemies, const SpatialHash& enemyGrid,
+		const TargetIndex& targets, TowerIntents& intents) = 0;
+	// Takes a shot recorded by update(). Shots are taken one at a time, in tower order, when the
+	// intents are applied. If earlier shots in the step already carry enough damage to kill the
+	// target, the tower picks another one, or holds its fire if there is none.
+	void takeShot(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets,
+		ProjectilePool& projectiles, SimulationEvents& events);
+	// Advances purely visual state, which may be stepped more coarsely than update()
+	virtual void updateEffects(float deltaTime) {}
 
 	bool tryUpgrade(int gold);
+	// Points the tower at a new table, e.g. when the balance is reloaded. The tower keeps its
+	// level, unless the new table has fewer levels.
+	void setLevels(const std::vector<TowerRegistry::LevelStats>& levels);
 	inline void markForUpgrade() { m_isMarkedForUpgrade = true; }
 	inline void markForSale() { m_isMarkedForSale = true; }
-	inline void setRangeCircleVisible(bool isVisible) { isRangeCircleVisible = isVisible; }
+	inline void setRangeCircleVisible(bool isVisible) { m_isRangeCircleVisible = isVisible; }
+	inline void setTargetingPolicy(TargetIndex::Policy policy) { targetingPolicy = policy; }
 
 	inline const TowerRegistry::Type& getType() const { return type; }
 	inline const std::string& getName() const {	return TowerRegistry::getTowerMetadataRegistry()[static_cast<int>(type)].name; }
-	const std::vector<TowerRegistry::AttributesPerLevel>& getAttributes() const { return attributes; }
+	inline const std::vector<TowerRegistry::LevelStats>& getAttributes() const { return *levels; }
+	// The stats of the tower's current level
+	inline const TowerRegistry::LevelStats& getStats() const { return *stats; }
 
     inline sf::Vector2i getTilePosition() const { return Utility::pixelToTilePosition(position); }
     inline sf::Vector2f getPixelPosition() const { return position; }
     inline int getLevel() const { return level; }
-	inline int getMaxLevel() const { return static_cast<int>(attributes.size() - 1); }
+	inline int getMaxLevel() const { return static_cast<int>(levels->size() - 1); }
+	inline TargetIndex::Policy getTargetingPolicy() const { return targetingPolicy; }
+	inline bool isRangeCircleVisible() const { return m_isRangeCircleVisible; }
     inline bool isMarkedForUpgrade() const { return m_isMarkedForUpgrade; }
 	inline bool isMarkedForSale() const { return m_isMarkedForSale; }
 
 	bool isSelected;
 
 protected:
-	virtual void fireAt(sf::Vector2f target) = 0;
-	void updateSelectionOutline();
-
-	inline bool canFire() const { return timeSinceLastShot >= attributes.at(level).fireRate; }
-
-	struct Bullet
-	{
-		bool hasHitEnemy = false;
-		sf::Vector2f positionCurrent;
-		sf::Vector2f positionPrevious;
-		sf::Vector2f direction;
-		sf::CircleShape shape;
-	};
-	std::vector<Bullet> bullets;
-	sf::Color bulletColor;
+	virtual void fireAt(int target, EnemyPool& enemies, const SpatialHash& enemyGrid, ProjectilePool& projectiles,
+		SimulationEvents& events) = 0;
+	// Returns the enemy in range that the tower's targeting policy prefers, or -1 if there is none
+	int findTarget(const SpatialHash& enemyGrid, const TargetIndex& targets);
+
+	inline bool canFire() const { return timeSinceLastShot >= stats->fireRate; }
+
 	float bulletSpeed;
 
-	std::vector<TowerRegistry::AttributesPerLevel> attributes;
+	const std::vector<TowerRegistry::LevelStats>* levels;
+	const TowerRegistry::LevelStats* stats; // The entry of the current level; only changes with the level
 
 	sf::Vector2f position;
 
 	TowerRegistry::Type type;
 	float timeSinceLastShot;
 
-	int level;
+	TargetIndex::Policy targetingPolicy;
+	// Stretches of the path within range, found again whenever the range changes
+	TargetIndex::PathSpans rangeOnPath;
+	float rangeOnPathRadius;
 
-	sf::RectangleShape shape;
-	sf::RectangleShape shape2;
-	sf::RectangleShape shape3;
-	sf::CircleShape rangeCircle;
-	bool isRangeCircleVisible;
-	sf::Color towerColor;
+	int level;
 
+	bool m_isRangeCircleVisible;
 	bool m_isMarkedForSale;
 	bool m_isMarkedForUpgrade;
 };
\ No newline at end of file
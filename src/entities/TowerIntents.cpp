@@ -0,0 +1,31 @@
+// ================================================================================================
+// File: TowerIntents.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 21, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include "TowerIntents.hpp"
+#include "Tower.hpp"
+
+void TowerIntents::apply(EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets,
+	ProjectilePool& projectilePool, SimulationEvents& events) const
+{
+	for (const ShotIntent& shot : shots)
+		shot.tower->takeShot(shot.enemyIndex, enemies, enemyGrid, targets, projectilePool, events);
+
+	for (const StatusEffectIntent& statusEffect : statusEffects)
+		enemies.applyStatusEffect(statusEffect.enemyIndex, statusEffect.effect);
+
+	for (const SoundIntent& sound : sounds)
+		events.queueSound(sound.soundID, sound.pitchVariancePercentage);
+}
+
+void TowerIntents::clear()
+{
+	shots.clear();
+	statusEffects.clear();
+	sounds.clear();
+}
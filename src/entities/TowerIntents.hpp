@@ -0,0 +1,66 @@
+// ================================================================================================
+// File: TowerIntents.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 21, 2025
+// Description: Defines the TowerIntents class, a buffer of everything towers want to do to the
+//              shared state in one fixed step: shots to take, status effects to apply and sounds
+//              to play. Towers only read the enemy pool while filling it, so several buffers can
+//              be filled in parallel; applying them one after another in a fixed order gives the
+//              same result on any number of threads.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "TowerRegistry.hpp"
+#include "EnemyPool.hpp"
+#include "ProjectilePool.hpp"
+#include "../core/SimulationEvents.hpp"
+#include "../core/SpatialHash.hpp"
+
+class Tower;
+class TargetIndex;
+
+class TowerIntents
+{
+public:
+	TowerIntents() = default;
+
+	inline void takeShot(Tower* tower, int enemyIndex) { shots.push_back({ tower, enemyIndex }); }
+	inline void applyStatusEffect(int enemyIndex, const EnemyPool::StatusEffect& effect) { statusEffects.push_back({ enemyIndex, effect }); }
+	inline void queueSound(SoundID soundID, float pitchVariancePercentage = 0.f) { sounds.push_back({ soundID, pitchVariancePercentage }); }
+
+	// Applies every intent in the order it was added. Intents of different kinds do not affect
+	// each other, so each kind is applied as a group. Shots are taken through Tower::takeShot,
+	// which sees the incoming damage of every shot taken before it.
+	void apply(EnemyPool& enemies, const SpatialHash& enemyGrid, const TargetIndex& targets,
+		ProjectilePool& projectilePool, SimulationEvents& events) const;
+	void clear();
+
+private:
+	struct ShotIntent
+	{
+		Tower* tower;
+		int enemyIndex;
+	};
+
+	struct StatusEffectIntent
+	{
+		int enemyIndex;
+		EnemyPool::StatusEffect effect;
+	};
+
+	struct SoundIntent
+	{
+		SoundID soundID;
+		float pitchVariancePercentage;
+	};
+
+	std::vector<ShotIntent> shots;
+	std::vector<StatusEffectIntent> statusEffects;
+	std::vector<SoundIntent> sounds;
+};
@@ -41,6 +41,20 @@ namespace TowerRegistry
         float slowDuration;    // in seconds
     };
 
+    // One level's attributes along with the values derived from them, worked out once when a
+    // balance is applied rather than in every tower update
+    struct LevelStats : AttributesPerLevel
+    {
+        explicit LevelStats(const AttributesPerLevel& attributes) :
+            AttributesPerLevel(attributes),
+            rangeSquared(attributes.range * attributes.range),
+            splashRadiusSquared(attributes.splashRadius * attributes.splashRadius)
+        {}
+
+        float rangeSquared;
+        float splashRadiusSquared;
+    };
+
     struct TowerMetadata
     {
         Type type;
@@ -3,15 +3,51 @@
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: April 28, 2025
 // Description: Starting point for the project.
+//              Usage: TowerDefenseGame [--record FILE] [--replay FILE] [--profile-csv FILE]
+//                     [--max-updates-per-frame N] [--map-size COLSxROWS] [--balance FILE]
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <iostream>
+#include <string>
 #include "core/Game.hpp"
+#include "core/Utility.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
-	Game game;
+	Game game(argv[0]);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--record" && i + 1 < argc)
+			game.setRecordFilename(argv[++i]);
+		else if (arg == "--replay" && i + 1 < argc)
+		{
+			if (!game.loadReplay(argv[++i]))
+				return 1;
+		}
+		else if (arg == "--profile-csv" && i + 1 < argc)
+			game.setProfileCsvFilename(argv[++i]);
+		else if (arg == "--max-updates-per-frame" && i + 1 < argc)
+			game.setMaxUpdatesPerFrame(std::stoi(argv[++i]));
+		else if (arg == "--map-size" && i + 1 < argc && Utility::parseMapSize(argv[i + 1]))
+			game.setMapSize(*Utility::parseMapSize(argv[++i]));
+		else if (arg == "--balance" && i + 1 < argc)
+		{
+			if (!game.loadBalance(argv[++i]))
+				return 1;
+		}
+		else if (arg == "--maze")
+			game.setPathingMode(Grid::PathingMode::Maze);
+		else
+		{
+			std::cerr << "Usage: TowerDefenseGame [--record FILE] [--replay FILE] [--profile-csv FILE] [--max-updates-per-frame N] [--map-size COLSxROWS] [--balance FILE] [--maze]" << std::endl;
+			return 1;
+		}
+	}
+
 	return game.run();
 }
\ No newline at end of file
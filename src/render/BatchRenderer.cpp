@@ -0,0 +1,66 @@
+// ================================================================================================
+// File: BatchRenderer.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 16, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <cmath>
+#include <limits>
+#include "BatchRenderer.hpp"
+
+BatchRenderer::BatchRenderer() :
+	vertices(sf::PrimitiveType::Triangles),
+	visibleMin(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()),
+	visibleMax(std::numeric_limits<float>::max(), std::numeric_limits<float>::max())
+{
+	const float pi = 3.14159265f;
+
+	for (std::size_t i = 0; i <= CIRCLE_SEGMENTS; ++i)
+	{
+		float angle = 2.f * pi * static_cast<float>(i) / static_cast<float>(CIRCLE_SEGMENTS);
+		unitCircle[i] = { std::cos(angle), std::sin(angle) };
+	}
+}
+
+void BatchRenderer::clear()
+{
+	// Keeps the allocated vertices around, so a steady frame does not allocate
+	vertices.clear();
+}
+
+void BatchRenderer::setVisibleArea(const sf::FloatRect& area)
+{
+	visibleMin = area.position;
+	visibleMax = area.position + area.size;
+}
+
+void BatchRenderer::addCircle(sf::Vector2f center, float radius, sf::Color color)
+{
+	if (radius <= 0.f || color.a == 0)
+		return;
+	if (center.x + radius < visibleMin.x || center.x - radius > visibleMax.x ||
+		center.y + radius < visibleMin.y || center.y - radius > visibleMax.y)
+		return;
+
+	std::size_t first = vertices.getVertexCount();
+	vertices.resize(first + VERTICES_PER_CIRCLE);
+
+	// A separate triangle per segment, since triangle fans cannot be joined into one draw call
+	for (std::size_t i = 0; i < CIRCLE_SEGMENTS; ++i)
+	{
+		sf::Vertex* triangle = &vertices[first + i * 3];
+		triangle[0].position = center;
+		triangle[1].position = center + unitCircle[i] * radius;
+		triangle[2].position = center + unitCircle[i + 1] * radius;
+		triangle[0].color = triangle[1].color = triangle[2].color = color;
+	}
+}
+
+void BatchRenderer::draw(sf::RenderTarget& target) const
+{
+	if (vertices.getVertexCount() > 0)
+		target.draw(vertices);
+}
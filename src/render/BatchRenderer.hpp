@@ -0,0 +1,47 @@
+// ================================================================================================
+// File: BatchRenderer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 16, 2025
+// Description: Defines the BatchRenderer class, which collects filled circles (enemies, bullets,
+//              explosions and death particles) into a single vertex array during a frame and
+//              submits them to the window with one draw call. Circles are built from unit circle
+//              vertices that are computed once, so adding a circle is only a scale and offset.
+//              Circles are drawn in the order they were added. Circles entirely outside the visible
+//              area are skipped, so off-screen entities cost no vertices.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <SFML/Graphics.hpp>
+
+class BatchRenderer
+{
+public:
+	BatchRenderer();
+
+	// Starts a new batch; call once per frame before adding anything.
+	void clear();
+	// Circles outside this area (in world coordinates) are dropped. Everything is kept by default.
+	void setVisibleArea(const sf::FloatRect& area);
+
+	void addCircle(sf::Vector2f center, float radius, sf::Color color);
+
+	// Draws everything added since the last clear() in a single draw call.
+	void draw(sf::RenderTarget& target) const;
+
+	inline std::size_t getCircleCount() const { return vertices.getVertexCount() / VERTICES_PER_CIRCLE; }
+
+	// Same point count sf::CircleShape uses by default
+	static constexpr std::size_t CIRCLE_SEGMENTS = 30;
+	static constexpr std::size_t VERTICES_PER_CIRCLE = CIRCLE_SEGMENTS * 3;
+
+private:
+	std::array<sf::Vector2f, CIRCLE_SEGMENTS + 1> unitCircle;
+	sf::VertexArray vertices;
+	sf::Vector2f visibleMin;
+	sf::Vector2f visibleMax;
+};
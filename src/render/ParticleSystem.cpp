@@ -0,0 +1,124 @@
+// ================================================================================================
+// File: ParticleSystem.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "ParticleSystem.hpp"
+#include "../core/Utility.hpp"
+
+const int ParticleSystem::CAPACITY = 4096;
+
+ParticleSystem::ParticleSystem() :
+	positionX(CAPACITY),
+	positionY(CAPACITY),
+	previousX(CAPACITY),
+	previousY(CAPACITY),
+	velocityX(CAPACITY),
+	velocityY(CAPACITY),
+	age(CAPACITY),
+	lifetime(CAPACITY),
+	radius(CAPACITY),
+	color(CAPACITY),
+	oldestSlot(0),
+	count(0)
+{}
+
+void ParticleSystem::emit(sf::Vector2f position, sf::Vector2f velocity, float radius, float lifetime, sf::Color color)
+{
+	int slot = (oldestSlot + count) % CAPACITY;
+	if (count == CAPACITY)
+		oldestSlot = (oldestSlot + 1) % CAPACITY; // Overwrite the oldest particle
+	else
+		count++;
+
+	positionX[slot] = position.x;
+	positionY[slot] = position.y;
+	previousX[slot] = position.x;
+	previousY[slot] = position.y;
+	velocityX[slot] = velocity.x;
+	velocityY[slot] = velocity.y;
+	age[slot] = 0.f;
+	this->lifetime[slot] = lifetime;
+	this->radius[slot] = radius;
+	this->color[slot] = color;
+}
+
+void ParticleSystem::update(float deltaTime)
+{
+	// Stepping by nothing would still move the previous positions up to the current ones, and
+	// the particles would stand still until the next real step
+	if (deltaTime <= 0.f)
+		return;
+
+	const int end = oldestSlot + count;
+	updateRange(oldestSlot, std::min(end, CAPACITY), deltaTime);
+	if (end > CAPACITY)
+		updateRange(0, end - CAPACITY, deltaTime);
+
+	// Lifetimes differ, so a particle that expired behind a live one stays in the window until
+	// the older one expires too
+	while (count > 0 && age[oldestSlot] >= lifetime[oldestSlot])
+	{
+		oldestSlot = (oldestSlot + 1) % CAPACITY;
+		count--;
+	}
+}
+
+void ParticleSystem::render(float interpolationFactor, BatchRenderer& batch) const
+{
+	const int end = oldestSlot + count;
+	renderRange(oldestSlot, std::min(end, CAPACITY), interpolationFactor, batch);
+	if (end > CAPACITY)
+		renderRange(0, end - CAPACITY, interpolationFactor, batch);
+}
+
+void ParticleSystem::clear()
+{
+	oldestSlot = 0;
+	count = 0;
+}
+
+void ParticleSystem::updateRange(int first, int last, float deltaTime)
+{
+	// Expired particles in the range are moved along with the rest; skipping them would cost a
+	// branch per particle and stop the loops from being vectorized
+	float* x = positionX.data();
+	float* y = positionY.data();
+	float* px = previousX.data();
+	float* py = previousY.data();
+	const float* vx = velocityX.data();
+	const float* vy = velocityY.data();
+	float* ages = age.data();
+
+	for (int i = first; i < last; ++i)
+	{
+		px[i] = x[i];
+		py[i] = y[i];
+	}
+	for (int i = first; i < last; ++i)
+	{
+		x[i] += vx[i] * deltaTime;
+		y[i] += vy[i] * deltaTime;
+	}
+	for (int i = first; i < last; ++i)
+		ages[i] += deltaTime;
+}
+
+void ParticleSystem::renderRange(int first, int last, float interpolationFactor, BatchRenderer& batch) const
+{
+	for (int i = first; i < last; ++i)
+	{
+		if (age[i] >= lifetime[i])
+			continue;
+
+		sf::Color fadedColor = color[i];
+		fadedColor.a = static_cast<std::uint8_t>(255.f * (1.f - age[i] / lifetime[i]));
+		batch.addCircle(Utility::interpolate({ previousX[i], previousY[i] }, { positionX[i], positionY[i] }, interpolationFactor),
+			radius[i], fadedColor);
+	}
+}
@@ -0,0 +1,57 @@
+// ================================================================================================
+// File: ParticleSystem.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 26, 2025
+// Description: Defines the ParticleSystem class, a single fixed-capacity store for every short-lived
+//              particle in the game (currently the bursts left behind by dying enemies). Particles
+//              are kept as a structure of arrays in a ring buffer: emitting writes after the newest
+//              particle, so it never allocates, and once full the oldest particles simply disappear
+//              early. Only the window between the oldest live particle and the newest is updated,
+//              with one branch-free pass of plain arithmetic per array that the compiler can
+//              vectorize, and every live particle is added to the frame's circle batch.
+//              Particles are purely visual; the simulation never reads them.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "BatchRenderer.hpp"
+
+class ParticleSystem
+{
+public:
+	ParticleSystem();
+
+	// Adds a particle that moves at a constant velocity and fades out over its lifetime
+	void emit(sf::Vector2f position, sf::Vector2f velocity, float radius, float lifetime, sf::Color color);
+	// Does nothing when no time has passed, so frames without a fixed update keep interpolating
+	void update(float deltaTime);
+	void render(float interpolationFactor, BatchRenderer& batch) const;
+
+	void clear();
+
+	// Particles in the live window; some near its end may already have expired
+	inline int getActiveCount() const { return count; }
+
+	static const int CAPACITY;
+
+private:
+	// Advances the particles in slots [first, last), which must not wrap around
+	void updateRange(int first, int last, float deltaTime);
+	void renderRange(int first, int last, float interpolationFactor, BatchRenderer& batch) const;
+
+	std::vector<float> positionX, positionY;
+	std::vector<float> previousX, previousY;
+	std::vector<float> velocityX, velocityY;
+	std::vector<float> age;
+	std::vector<float> lifetime; // A particle has expired once its age reaches its lifetime
+	std::vector<float> radius;
+	std::vector<sf::Color> color;
+
+	int oldestSlot; // Start of the live window, which wraps around the end of the arrays
+	int count;      // Particles in the live window
+};
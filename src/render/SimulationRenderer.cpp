@@ -0,0 +1,343 @@
+// ================================================================================================
+// File: SimulationRenderer.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 27, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cmath>
+#include "SimulationRenderer.hpp"
+#include "../core/Utility.hpp"
+#include "../entities/SlowTower.hpp"
+
+namespace
+{
+	struct TowerColors
+	{
+		sf::Color color;
+		sf::Color color2;
+		sf::Color color3;
+	};
+
+	struct ProjectileAppearance
+	{
+		float radius;
+		sf::Color color;
+	};
+
+	// Indexed by TowerRegistry::Type
+	const TowerColors towerColors[] =
+	{
+		{ sf::Color(8, 74, 44), sf::Color(9, 83, 49), sf::Color(10, 92, 54) },    // Bullet
+		{ sf::Color(205, 65, 43), sf::Color(225, 70, 47), sf::Color(255, 75, 51) }, // Splash
+		{ sf::Color(8, 60, 86), sf::Color(9, 66, 96), sf::Color(10, 73, 106) }     // Slow
+	};
+	static_assert(sizeof(towerColors) / sizeof(towerColors[0]) == static_cast<std::size_t>(TowerRegistry::Type::Count),
+		"Every tower type needs its colors");
+
+	// Indexed by TowerRegistry::Type
+	const ProjectileAppearance projectileAppearances[] =
+	{
+		{ 5.f, sf::Color(5, 46, 27) },   // Bullet
+		{ 8.f, sf::Color(123, 37, 25) }, // Splash
+		{ 0.f, sf::Color::Transparent }  // Slow (does not fire projectiles)
+	};
+	static_assert(sizeof(projectileAppearances) / sizeof(projectileAppearances[0]) == static_cast<std::size_t>(TowerRegistry::Type::Count),
+		"Every tower type needs a projectile appearance");
+
+	// Blends two colors based on the alpha value of the overlay color
+	sf::Color blendColors(sf::Color base, sf::Color overlay)
+	{
+		float alpha = overlay.a / 255.f;
+
+		auto blendChannel = [&](std::uint8_t baseChannel, std::uint8_t overlayChannel)
+		{
+			return static_cast<std::uint8_t>(baseChannel * (1.f - alpha) + overlayChannel * alpha);
+		};
+
+		return sf::Color
+		(
+			blendChannel(base.r, overlay.r),
+			blendChannel(base.g, overlay.g),
+			blendChannel(base.b, overlay.b),
+			255
+		);
+	}
+
+	// Cheap integer hash, so neighbouring tiles get unrelated shades
+	std::uint32_t hashTile(int col, int row, std::uint32_t seed)
+	{
+		std::uint32_t hash = seed ^ (static_cast<std::uint32_t>(col) * 0x9E3779B1u) ^ (static_cast<std::uint32_t>(row) * 0x85EBCA77u);
+		hash ^= hash >> 16;
+		hash *= 0x7FEB352Du;
+		hash ^= hash >> 15;
+		hash *= 0x846CA68Bu;
+		hash ^= hash >> 16;
+		return hash;
+	}
+
+	// Grass tiles get a slightly varied shade, which only depends on the tile's position and the
+	// level's shade seed, so it does not need to be stored
+	sf::Color getTileColor(Tile::Type type, int col, int row, std::uint32_t shadeSeed)
+	{
+		switch (type)
+		{
+		case Tile::Type::Start:
+		case Tile::Type::End:
+		case Tile::Type::Pathable:
+			return sf::Color(155, 118, 83);
+
+		// Towers stand on grass
+		case Tile::Type::Buildable:
+		case Tile::Type::Tower:
+		{
+			std::uint32_t hash = hashTile(col, row, shadeSeed);
+			return sf::Color
+			(
+				static_cast<std::uint8_t>(157 + (hash & 0xFF) % 9),          //161,
+				static_cast<std::uint8_t>(217 + ((hash >> 8) & 0xFF) % 13), //223,
+				static_cast<std::uint8_t>(77 + ((hash >> 16) & 0xFF) % 7)   //80
+			);
+		}
+
+		default:
+			return sf::Color(255, 255, 255, 100);
+		}
+	}
+
+	// Appends the tile's fill as two triangles, for drawing many tiles in one call
+	void appendTileVertices(sf::VertexArray& vertices, Tile::Type type, int col, int row, std::uint32_t shadeSeed)
+	{
+		const float size = Grid::TILE_SIZE;
+		sf::Vector2f topLeft(col * size, row * size);
+		sf::Vector2f topRight = topLeft + sf::Vector2f(size, 0.f);
+		sf::Vector2f bottomLeft = topLeft + sf::Vector2f(0.f, size);
+		sf::Vector2f bottomRight = topLeft + sf::Vector2f(size, size);
+		sf::Color color = getTileColor(type, col, row, shadeSeed);
+
+		vertices.append({ topLeft, color });
+		vertices.append({ topRight, color });
+		vertices.append({ bottomLeft, color });
+		vertices.append({ bottomLeft, color });
+		vertices.append({ topRight, color });
+		vertices.append({ bottomRight, color });
+	}
+
+	void setupSquare(sf::RectangleShape& shape, float size)
+	{
+		shape.setSize({ size, size });
+		shape.setOrigin({ size / 2.f, size / 2.f });
+	}
+
+	void setCircleRadius(sf::CircleShape& circle, float radius, sf::Vector2f center)
+	{
+		circle.setRadius(radius);
+		circle.setOrigin({ radius, radius });
+		circle.setPosition(center);
+	}
+}
+
+SimulationRenderer::SimulationRenderer() :
+	rng(Rng::makeRandomSeed()),
+	tileLayer(sf::PrimitiveType::Triangles),
+	tileLayerRevision(0),
+	isTileLayerBuilt(false),
+	enemyColor(sf::Color(71, 28, 28)),
+	flashColor(sf::Color::White),
+	slowOverlayColor(sf::Color(54, 139, 193, 123)),
+	explosionColor(sf::Color(255, 75, 51, 200)),
+	slowedEnemyColor(blendColors(enemyColor, slowOverlayColor))
+{
+	selectionOutline.setSize({ Grid::TILE_SIZE, Grid::TILE_SIZE });
+	selectionOutline.setFillColor(sf::Color(0, 0, 0, 0));
+	selectionOutline.setOutlineColor(sf::Color(255, 255, 255, 255));
+	selectionOutline.setOutlineThickness(4.f);
+
+	setupSquare(towerShape, 80.f);
+	setupSquare(towerShape2, 60.f);
+	setupSquare(towerShape3, 40.f);
+	towerShape.setOutlineColor(sf::Color(255, 255, 255, 255));
+
+	rangeCircle.setFillColor(sf::Color(0, 0, 0, 15));
+	rangeCircle.setOutlineColor(sf::Color(0, 0, 0, 50));
+	rangeCircle.setOutlineThickness(2.f);
+	rangeCircle.setPointCount(100);
+}
+
+void SimulationRenderer::handleEvents(const SimulationEvents& events)
+{
+	for (const SimulationEvents::EnemyDeath& death : events.getEnemyDeaths())
+		startDeathEffect(death.position, death.statusEffects);
+}
+
+void SimulationRenderer::updateEffects(float deltaTime)
+{
+	particles.update(deltaTime);
+}
+
+void SimulationRenderer::clear()
+{
+	particles.clear();
+}
+
+void SimulationRenderer::renderGrid(const Grid& grid, sf::RenderWindow& window)
+{
+	const int cols = static_cast<int>(grid.getSize().x);
+	const int rows = static_cast<int>(grid.getSize().y);
+	const float TILE_SIZE = Grid::TILE_SIZE;
+
+	// Only the tiles overlapping the view are put into the layer
+	const sf::View& view = window.getView();
+	sf::Vector2f viewTopLeft = view.getCenter() - view.getSize() / 2.f;
+	sf::Vector2f viewBottomRight = view.getCenter() + view.getSize() / 2.f;
+
+	sf::Vector2i begin(
+		std::clamp(static_cast<int>(std::floor(viewTopLeft.x / TILE_SIZE)), 0, cols),
+		std::clamp(static_cast<int>(std::floor(viewTopLeft.y / TILE_SIZE)), 0, rows));
+	sf::Vector2i end(
+		std::clamp(static_cast<int>(std::ceil(viewBottomRight.x / TILE_SIZE)), 0, cols),
+		std::clamp(static_cast<int>(std::ceil(viewBottomRight.y / TILE_SIZE)), 0, rows));
+
+	if (!isTileLayerBuilt || grid.getRevision() != tileLayerRevision || begin != tileLayerBegin || end != tileLayerEnd)
+		rebuildTileLayer(grid, begin, end);
+
+	window.draw(tileLayer);
+
+	sf::Vector2i selectedTile = grid.getSelectedTile();
+	if (selectedTile.x >= 0 && selectedTile.y >= 0)
+	{
+		selectionOutline.setPosition({ selectedTile.x * TILE_SIZE, selectedTile.y * TILE_SIZE });
+		window.draw(selectionOutline);
+	}
+}
+
+void SimulationRenderer::renderTower(const Tower& tower, sf::RenderWindow& window)
+{
+	const TowerColors& colors = towerColors[static_cast<int>(tower.getType())];
+	const sf::Vector2f position = tower.getPixelPosition();
+	const float range = tower.getStats().range;
+
+	if (tower.getType() == TowerRegistry::Type::Slow)
+	{
+		float t = static_cast<const SlowTower&>(tower).getPulseProgress();
+		if (t >= 0.f)
+		{
+			int alpha = static_cast<int>((1.f - t) * slowOverlayColor.a); // Fade out
+			pulseCircle.setFillColor(sf::Color(slowOverlayColor.r, slowOverlayColor.g, slowOverlayColor.b, static_cast<std::uint8_t>(alpha)));
+			setCircleRadius(pulseCircle, range * t, position);
+			window.draw(pulseCircle);
+		}
+	}
+
+	if (tower.isRangeCircleVisible())
+	{
+		setCircleRadius(rangeCircle, range, position);
+		window.draw(rangeCircle);
+	}
+
+	towerShape.setFillColor(colors.color);
+	towerShape.setOutlineThickness(tower.isSelected ? 4.f : 0.f);
+	towerShape.setPosition(position);
+	window.draw(towerShape);
+	if (tower.getLevel() > 0)
+	{
+		towerShape2.setFillColor(colors.color2);
+		towerShape2.setPosition(position);
+		window.draw(towerShape2);
+	}
+	if (tower.getLevel() > 1)
+	{
+		towerShape3.setFillColor(colors.color3);
+		towerShape3.setPosition(position);
+		window.draw(towerShape3);
+	}
+}
+
+void SimulationRenderer::renderEntities(const Simulation& simulation, float interpolationFactor, BatchRenderer& batch) const
+{
+	const ProjectilePool& projectiles = simulation.getProjectiles();
+	projectiles.forEachActive([&](const ProjectilePool::Projectile& projectile)
+		{
+			const ProjectileAppearance& appearance = projectileAppearances[static_cast<int>(projectile.type)];
+			batch.addCircle(Utility::interpolate(projectile.positionPrevious, projectile.positionCurrent, interpolationFactor),
+				appearance.radius, appearance.color);
+		});
+
+	for (const ProjectilePool::Explosion& explosion : projectiles.getExplosions())
+	{
+		float t = explosion.timer / ProjectilePool::EXPLOSION_DURATION;
+		int alpha = static_cast<int>((1.f - t) * explosionColor.a); // Fade out
+		batch.addCircle(explosion.position, explosion.radius * t,
+			sf::Color(explosionColor.r, explosionColor.g, explosionColor.b, static_cast<std::uint8_t>(alpha)));
+	}
+
+	particles.render(interpolationFactor, batch);
+
+	const EnemyPool& enemies = simulation.getEnemies();
+	for (int i = 0; i < enemies.size(); ++i)
+	{
+		// Enemies killed this frame are only removed at the end of the fixed step
+		if (enemies.isDead(i))
+			continue;
+
+		sf::Color color = getEnemyColor(enemies.getActiveStatusEffects(i));
+		float flash = enemies.getDamageFlash(i);
+		if (flash > 0.f)
+		{
+			color = flashColor;
+			color.a = static_cast<std::uint8_t>(255 * flash);
+		}
+
+		batch.addCircle(Utility::interpolate(enemies.getPreviousPixelPosition(i), enemies.getPixelPosition(i), interpolationFactor),
+			EnemyPool::SIZE, color);
+	}
+}
+
+void SimulationRenderer::startDeathEffect(sf::Vector2f position, std::uint8_t statusEffects)
+{
+	const sf::Color color = getEnemyColor(statusEffects);
+	const int MAX_PARTICLES = 6;
+	int amount = rng.range(4, MAX_PARTICLES);
+
+	// Draw every particle's random values in one go
+	int sizes[MAX_PARTICLES];
+	float angles[MAX_PARTICLES];
+	float speeds[MAX_PARTICLES];
+	float lifetimes[MAX_PARTICLES];
+	rng.fill(sizes, amount, 3, 6);
+	rng.fill(angles, amount, 0.f, 360.f);
+	rng.fill(speeds, amount, 50.f, 100.f);
+	rng.fill(lifetimes, amount, 0.4f, 0.6f);
+
+	for (int i = 0; i < amount; ++i)
+		particles.emit(position, Utility::angleToVector(angles[i]) * speeds[i], static_cast<float>(sizes[i]), lifetimes[i], color);
+}
+
+void SimulationRenderer::rebuildTileLayer(const Grid& grid, sf::Vector2i begin, sf::Vector2i end)
+{
+	tileLayer.clear();
+
+	for (int row = begin.y; row < end.y; ++row)
+	{
+		for (int col = begin.x; col < end.x; ++col)
+		{
+			appendTileVertices(tileLayer, grid.getTileType(col, row), col, row, grid.getShadeSeed());
+		}
+	}
+
+	tileLayerBegin = begin;
+	tileLayerEnd = end;
+	tileLayerRevision = grid.getRevision();
+	isTileLayerBuilt = true;
+}
+
+sf::Color SimulationRenderer::getEnemyColor(std::uint8_t statusEffects) const
+{
+	// The only status effect so far; with more, the one with the highest type would win
+	if (statusEffects & (1 << static_cast<int>(EnemyPool::StatusEffect::Type::Slow)))
+		return slowedEnemyColor;
+	return enemyColor;
+}
@@ -0,0 +1,69 @@
+// ================================================================================================
+// File: SimulationRenderer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 27, 2025
+// Description: Defines the SimulationRenderer class, which draws the state of a Simulation: the
+//              grid, the towers and everything round that moves over them. It also owns the
+//              particle system, which is fed from the enemy deaths the simulation reports, so the
+//              simulation itself never touches anything graphical.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <SFML/Graphics.hpp>
+#include "BatchRenderer.hpp"
+#include "ParticleSystem.hpp"
+#include "../core/Rng.hpp"
+#include "../core/Simulation.hpp"
+
+class SimulationRenderer
+{
+public:
+	SimulationRenderer();
+
+	// Starts the death effects of the enemies killed in the last fixed update
+	void handleEvents(const SimulationEvents& events);
+	// Advances the particles
+	void updateEffects(float deltaTime);
+	void clear();
+
+	// Draws the tiles in the window's current view, with the selected tile outlined on top. Only
+	// the tiles in view are drawn; they are cached in a single vertex array that is rebuilt when
+	// the grid changes or the view moves onto other tiles.
+	void renderGrid(const Grid& grid, sf::RenderWindow& window);
+	void renderTower(const Tower& tower, sf::RenderWindow& window);
+	// Adds the projectiles, explosions, particles and enemies to the batch, in that order
+	void renderEntities(const Simulation& simulation, float interpolationFactor, BatchRenderer& batch) const;
+
+private:
+	void startDeathEffect(sf::Vector2f position, std::uint8_t statusEffects);
+	// Fills the tile layer with the tiles in [begin, end)
+	void rebuildTileLayer(const Grid& grid, sf::Vector2i begin, sf::Vector2i end);
+	// An enemy's color before any damage flash
+	sf::Color getEnemyColor(std::uint8_t statusEffects) const;
+
+	ParticleSystem particles;
+	Rng rng; // Only decides how the particles look, so it is not part of the game's seed
+
+	sf::VertexArray tileLayer;
+	sf::Vector2i tileLayerBegin, tileLayerEnd; // Range of tiles currently in the tile layer
+	std::uint32_t tileLayerRevision;           // Revision of the grid the tile layer was built from
+	bool isTileLayerBuilt;
+	sf::RectangleShape selectionOutline;
+
+	sf::RectangleShape towerShape;
+	sf::RectangleShape towerShape2;
+	sf::RectangleShape towerShape3;
+	sf::CircleShape rangeCircle;
+	sf::CircleShape pulseCircle;
+
+	const sf::Color enemyColor;
+	const sf::Color flashColor;
+	const sf::Color slowOverlayColor;
+	const sf::Color explosionColor;
+	const sf::Color slowedEnemyColor; // The enemy color with the slow overlay blended in
+};
@@ -0,0 +1,34 @@
+// ================================================================================================
+// File: AssetPacker.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 23, 2025
+// Description: Starting point for the asset packer, which runs at build time. It decodes every
+//              asset in the manifest and writes them into a single archive that the game maps into
+//              memory at startup instead of opening and decoding each file.
+//              Must be run from the project root, where the manifest's paths are valid.
+//              Usage: TowerDefenseAssetPacker [OUTPUT]   (default: assets.pak next to the packer)
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <iostream>
+#include <string>
+#include "../core/AssetArchive.hpp"
+#include "../core/AssetManifest.hpp"
+
+int main(int argc, char* argv[])
+{
+	if (argc > 2)
+	{
+		std::cerr << "Usage: TowerDefenseAssetPacker [OUTPUT]" << std::endl;
+		return 1;
+	}
+
+	std::string filename = argc == 2 ? argv[1] : AssetManifest::getArchivePath(argv[0]);
+	if (!AssetArchive::pack(filename))
+		return 1;
+
+	std::cout << "Packed " << AssetManifest::getSounds().size() + 1 << " assets into " << filename << std::endl;
+	return 0;
+}
@@ -0,0 +1,378 @@
+// ================================================================================================
+// File: BalanceSweep.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 25, 2025
+// Description: Starting point for the balance sweep, which plays many headless games in parallel
+//              over a grid of Balance variants. Every combination of the given parameter values is
+//              played on the same seeds (seed + N for game N) by the scripted policy, so the
+//              results of two combinations differ only by the parameters.
+//              --scale multiplies a tower attribute on every level, e.g. --scale bullet.damage=0.8,1,1.2
+//              (integer attributes are rounded). --set replaces a Balance value, e.g.
+//              --set enemyHealthPerWave=0.25,0.33. Each option adds one axis to the grid. The values
+//              are applied on top of the built-in balance, or on top of a definitions file given
+//              with --balance.
+//              Prints the waves reached, the gold at the start of waves 10/20/30 and the share of
+//              damage done by each tower type per combination. --csv also writes the gold, lives
+//              and damage of every game at the start of every wave and at its end.
+//              Usage: TowerDefenseBalanceSweep [--games N] [--max-waves N] [--seed N] [--threads N]
+//                     [--map-size COLSxROWS] [--build-order TYPE,...] [--scale TOWER.ATTRIBUTE=V,...]
+//                     [--set NAME=V,...] [--csv FILE] [--balance FILE]
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../core/Simulation.hpp"
+#include "../core/ScriptedPolicy.hpp"
+#include "../core/Utility.hpp"
+
+namespace
+{
+	const char* USAGE =
+		"Usage: TowerDefenseBalanceSweep [--games N] [--max-waves N] [--seed N] [--threads N]\n"
+		"                                [--map-size COLSxROWS] [--build-order TYPE,...] [--scale TOWER.ATTRIBUTE=V,...]\n"
+		"                                [--set NAME=V,...] [--csv FILE] [--balance FILE]";
+
+	using BalanceSetter = std::function<void(Balance&, float)>;
+
+	std::vector<std::string> split(const std::string& text, char separator)
+	{
+		std::vector<std::string> parts;
+		std::istringstream ss(text);
+		std::string part;
+		while (std::getline(ss, part, separator))
+			parts.push_back(part);
+		return parts;
+	}
+
+	// One axis of the parameter grid
+	struct Parameter
+	{
+		std::string name;
+		std::vector<float> values;
+		BalanceSetter apply;
+	};
+
+	// Parses "NAME=V1,V2,..." for --scale or --set. Returns false on an unknown name or bad value.
+	bool parseParameter(const std::string& text, bool isScale, Parameter& parameter)
+	{
+		std::size_t equals = text.find('=');
+		if (equals == std::string::npos)
+			return false;
+
+		parameter.name = text.substr(0, equals);
+		parameter.values.clear();
+		for (const std::string& value : split(text.substr(equals + 1), ','))
+		{
+			try { parameter.values.push_back(std::stof(value)); }
+			catch (const std::exception&) { return false; }
+		}
+		if (parameter.values.empty())
+			return false;
+
+		if (isScale)
+		{
+			std::vector<std::string> parts = split(parameter.name, '.');
+			if (parts.size() != 2)
+				return false;
+			TowerRegistry::Type type = Balance::findTowerType(parts[0]);
+			const Balance::AttributeField* attribute = Balance::findAttributeField(parts[1]);
+			if (type == TowerRegistry::Type::Count || !attribute)
+				return false;
+
+			parameter.apply = [type, attribute](Balance& balance, float value)
+				{
+					for (TowerRegistry::AttributesPerLevel& level : balance.towerAttributes[static_cast<int>(type)])
+						attribute->set(level, attribute->get(level) * value);
+				};
+		}
+		else
+		{
+			const Balance::ValueField* field = Balance::findValueField(parameter.name);
+			if (!field)
+				return false;
+			parameter.apply = [field](Balance& balance, float value) { field->set(balance, value); };
+		}
+		return true;
+	}
+
+	// The state of a game at the start of a wave, or when it ended
+	struct Sample
+	{
+		int wave;
+		int gold;
+		int lives;
+		std::array<long long, static_cast<int>(TowerRegistry::Type::Count)> damage;
+	};
+
+	struct GameResult
+	{
+		std::uint64_t seed;
+		int waveReached;
+		std::vector<Sample> samples; // The last one is taken when the game ended
+	};
+
+	Sample takeSample(const Simulation& simulation)
+	{
+		Sample sample{ simulation.getWave(), simulation.getGold(), simulation.getLives(), {} };
+		for (int type = 0; type < static_cast<int>(TowerRegistry::Type::Count); ++type)
+			sample.damage[type] = simulation.getDamageDealt(static_cast<TowerRegistry::Type>(type));
+		return sample;
+	}
+
+	void playGame(Simulation& simulation, const ScriptedPolicy& policy, std::uint64_t seed, sf::Vector2i mapSize,
+		int maxWaves, GameResult& result)
+	{
+		simulation.reset(seed, mapSize);
+		result.seed = seed;
+		result.samples.clear();
+
+		int lastWave = simulation.getWave();
+		while (!simulation.isGameOver() && simulation.getWave() <= maxWaves)
+		{
+			policy.submitCommands(simulation);
+			simulation.update(Simulation::FIXED_TIME_STEP);
+			if (simulation.getWave() != lastWave)
+			{
+				lastWave = simulation.getWave();
+				result.samples.push_back(takeSample(simulation));
+			}
+		}
+
+		result.waveReached = simulation.getWave();
+		result.samples.push_back(takeSample(simulation));
+	}
+
+	// Returns the average gold at the start of the given wave over the games that reached it, or -1
+	int getAverageGoldAtWave(const std::vector<GameResult>& games, int wave)
+	{
+		long long total = 0;
+		int count = 0;
+		for (const GameResult& game : games)
+		{
+			for (std::size_t i = 0; i + 1 < game.samples.size(); ++i)
+			{
+				if (game.samples[i].wave == wave)
+				{
+					total += game.samples[i].gold;
+					count++;
+				}
+			}
+		}
+		return count > 0 ? static_cast<int>(total / count) : -1;
+	}
+
+	bool writeCsv(const std::string& filename, const std::vector<Parameter>& parameters,
+		const std::vector<std::vector<float>>& combinations, const std::vector<std::vector<GameResult>>& results)
+	{
+		std::ofstream file(filename);
+		if (!file)
+		{
+			std::cerr << "Error: Could not open " << filename << " for writing!" << std::endl;
+			return false;
+		}
+
+		file << "combination";
+		for (const Parameter& parameter : parameters)
+			file << "," << parameter.name;
+		file << ",seed,wave,is_end,gold,lives";
+		for (const TowerRegistry::TowerMetadata& metadata : TowerRegistry::getTowerMetadataRegistry())
+			file << ",damage_" << metadata.name;
+		file << "\n";
+
+		for (std::size_t combination = 0; combination < combinations.size(); ++combination)
+		{
+			for (const GameResult& game : results[combination])
+			{
+				for (std::size_t i = 0; i < game.samples.size(); ++i)
+				{
+					const Sample& sample = game.samples[i];
+					file << combination;
+					for (float value : combinations[combination])
+						file << "," << value;
+					file << "," << game.seed << "," << sample.wave << "," << (i + 1 == game.samples.size() ? 1 : 0)
+						<< "," << sample.gold << "," << sample.lives;
+					for (long long damage : sample.damage)
+						file << "," << damage;
+					file << "\n";
+				}
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int games = 8;
+	int maxWaves = 100;
+	std::uint64_t seed = Rng::makeRandomSeed();
+	int threadCount = WorkerPool::getDefaultThreadCount();
+	sf::Vector2i mapSize(10, 8);
+	std::vector<TowerRegistry::Type> buildOrder = { TowerRegistry::Type::Bullet, TowerRegistry::Type::Splash, TowerRegistry::Type::Slow };
+	std::vector<Parameter> parameters;
+	std::string csvFilename;
+	Balance baseBalance;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		Parameter parameter;
+		if (arg == "--games" && i + 1 < argc)
+			games = std::max(1, std::stoi(argv[++i]));
+		else if (arg == "--max-waves" && i + 1 < argc)
+			maxWaves = std::stoi(argv[++i]);
+		else if (arg == "--seed" && i + 1 < argc)
+			seed = std::stoull(argv[++i]);
+		else if (arg == "--threads" && i + 1 < argc)
+			threadCount = std::max(0, std::stoi(argv[++i]));
+		else if (arg == "--map-size" && i + 1 < argc && Utility::parseMapSize(argv[i + 1]))
+			mapSize = *Utility::parseMapSize(argv[++i]);
+		else if (arg == "--build-order" && i + 1 < argc)
+		{
+			buildOrder.clear();
+			for (const std::string& name : split(argv[++i], ','))
+				buildOrder.push_back(Balance::findTowerType(name));
+			if (buildOrder.empty() || std::count(buildOrder.begin(), buildOrder.end(), TowerRegistry::Type::Count) > 0)
+			{
+				std::cerr << "Error: Unknown tower type in build order!" << std::endl;
+				return 1;
+			}
+		}
+		else if ((arg == "--scale" || arg == "--set") && i + 1 < argc)
+		{
+			if (!parseParameter(argv[++i], arg == "--scale", parameter))
+			{
+				std::cerr << "Error: Invalid parameter " << argv[i] << "!" << std::endl;
+				return 1;
+			}
+			parameters.push_back(parameter);
+		}
+		else if (arg == "--csv" && i + 1 < argc)
+			csvFilename = argv[++i];
+		else if (arg == "--balance" && i + 1 < argc)
+		{
+			if (!baseBalance.loadFromFile(argv[++i]))
+				return 1;
+		}
+		else
+		{
+			std::cerr << USAGE << std::endl;
+			return 1;
+		}
+	}
+
+	// Every combination of parameter values, the first parameter varying slowest
+	std::vector<std::vector<float>> combinations(1);
+	for (const Parameter& parameter : parameters)
+	{
+		std::vector<std::vector<float>> extended;
+		for (const std::vector<float>& combination : combinations)
+		{
+			for (float value : parameter.values)
+			{
+				extended.push_back(combination);
+				extended.back().push_back(value);
+			}
+		}
+		combinations = std::move(extended);
+	}
+
+	std::vector<std::shared_ptr<const Balance>> balances;
+	for (const std::vector<float>& combination : combinations)
+	{
+		Balance balance = baseBalance;
+		for (std::size_t p = 0; p < parameters.size(); ++p)
+			parameters[p].apply(balance, combination[p]);
+		balances.push_back(std::make_shared<const Balance>(std::move(balance)));
+	}
+
+	std::vector<std::vector<GameResult>> results(combinations.size(), std::vector<GameResult>(static_cast<size_t>(games)));
+	const int jobCount = static_cast<int>(combinations.size()) * games;
+
+	// Games are spread over one lane per thread rather than one task each, so every lane reuses
+	// its simulation. Each game runs on a single thread; parallelism comes from running many.
+	WorkerPool workers(threadCount);
+	const int laneCount = threadCount + 1;
+	std::atomic<int> nextJob(0);
+	auto startTime = std::chrono::steady_clock::now();
+
+	workers.run(laneCount, [&](int)
+		{
+			Simulation simulation(mapSize.x, mapSize.y, seed);
+			simulation.setWorkerThreadCount(0);
+			ScriptedPolicy policy(buildOrder);
+
+			for (int job = nextJob++; job < jobCount; job = nextJob++)
+			{
+				int combination = job / games;
+				int game = job % games;
+				simulation.setBalance(balances[combination]);
+				playGame(simulation, policy, seed + game, mapSize, maxWaves, results[combination][game]);
+			}
+		});
+
+	float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+
+	for (std::size_t combination = 0; combination < combinations.size(); ++combination)
+	{
+		const std::vector<GameResult>& gameResults = results[combination];
+
+		std::cout << std::defaultfloat << std::setprecision(6) << "#" << combination;
+		for (std::size_t p = 0; p < parameters.size(); ++p)
+			std::cout << " " << parameters[p].name << "=" << combinations[combination][p];
+		std::cout << std::endl;
+
+		int minWave = gameResults.front().waveReached, maxWave = minWave;
+		long long totalWaves = 0;
+		std::array<long long, static_cast<int>(TowerRegistry::Type::Count)> damage = {};
+		for (const GameResult& game : gameResults)
+		{
+			minWave = std::min(minWave, game.waveReached);
+			maxWave = std::max(maxWave, game.waveReached);
+			totalWaves += game.waveReached;
+			for (std::size_t type = 0; type < damage.size(); ++type)
+				damage[type] += game.samples.back().damage[type];
+		}
+
+		std::cout << std::fixed << std::setprecision(1)
+			<< "    wave reached: " << static_cast<float>(totalWaves) / games << " avg (" << minWave << "-" << maxWave << ")"
+			<< " | gold at wave 10/20/30:";
+		for (int wave : { 10, 20, 30 })
+		{
+			int gold = getAverageGoldAtWave(gameResults, wave);
+			std::cout << (wave == 10 ? " " : "/") << (gold >= 0 ? std::to_string(gold) : "-");
+		}
+
+		long long totalDamage = std::max(1LL, std::accumulate(damage.begin(), damage.end(), 0LL));
+		std::cout << " | damage:";
+		for (const TowerRegistry::TowerMetadata& metadata : TowerRegistry::getTowerMetadataRegistry())
+		{
+			long long typeDamage = damage[static_cast<int>(metadata.type)];
+			std::cout << " " << metadata.name << " " << 100.f * typeDamage / totalDamage << "%";
+		}
+		std::cout << std::endl;
+	}
+
+	std::cout << "Played " << jobCount << " games (" << combinations.size() << " combinations x " << games
+		<< " seeds from " << seed << ") on " << laneCount << " threads in " << std::setprecision(2) << seconds << "s" << std::endl;
+
+	if (!csvFilename.empty() && !writeCsv(csvFilename, parameters, combinations, results))
+		return 1;
+
+	return 0;
+}
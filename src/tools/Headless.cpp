@@ -0,0 +1,164 @@
+// ================================================================================================
+// File: Headless.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 12, 2025
+// Description: Starting point for the headless runner, which plays games without a window, fonts
+//              or audio as fast as the CPU allows. Its options are listed in USAGE below.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <memory>
+#include "../core/Simulation.hpp"
+#include "../core/Replay.hpp"
+#include "../core/ScriptedPolicy.hpp"
+#include "../core/Utility.hpp"
+
+namespace
+{
+	const char* USAGE =
+		"Usage: TowerDefenseHeadless [--games N] [--max-waves N] [--seed N] [--record FILE] [--threads N]\n"
+		"                            [--map-size COLSxROWS] [--balance FILE] [--maze]\n"
+		"       TowerDefenseHeadless --replay FILE [--max-waves N] [--threads N] [--balance FILE]\n"
+		"\n"
+		"  --games N              Games to play, each on the next seed (default 1)\n"
+		"  --max-waves N          Stop a game once it has passed this wave (default 100)\n"
+		"  --seed N               Seed of the first game (random by default); the same seed plays\n"
+		"                         out the same games\n"
+		"  --record FILE          Save the first game's commands as a replay\n"
+		"  --replay FILE          Play back a recorded game, from here or from the game, instead of\n"
+		"                         the scripted policy, and report how fast it simulates\n"
+		"  --threads N            Worker threads for the tower update (one per core by default);\n"
+		"                         the games play out the same with any count\n"
+		"  --map-size COLSxROWS   Play on levels of this size instead of 10x8; replays use the size\n"
+		"                         they were recorded with\n"
+		"  --balance FILE         Play with the definitions in FILE instead of the built-in balance;\n"
+		"                         replays need the balance they were recorded with\n"
+		"  --maze                 Play on maze levels; replays store the pathing mode";
+
+	// Plays back a recorded game as fast as possible and reports how long it took.
+	int runReplay(const std::string& filename, int maxWaves, int threadCount, const std::shared_ptr<const Balance>& balance)
+	{
+		Replay replay;
+		if (!replay.loadFromFile(filename))
+			return 1;
+
+		Simulation simulation(replay.getMapSize().x, replay.getMapSize().y, replay.getSeed());
+		simulation.setWorkerThreadCount(threadCount);
+		simulation.setBalance(balance);
+		simulation.setPathingMode(replay.getPathingMode());
+		simulation.reset(replay.getSeed());
+		auto startTime = std::chrono::steady_clock::now();
+
+		while (!simulation.isGameOver() && simulation.getWave() <= maxWaves)
+		{
+			replay.submitDueCommands(simulation);
+			simulation.update(Simulation::FIXED_TIME_STEP);
+			simulation.updateEffects(Simulation::FIXED_TIME_STEP);
+		}
+
+		float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+		std::cout << "Replayed " << replay.getCommandCount() << " commands (seed " << replay.getSeed() << ", "
+			<< replay.getMapSize().x << "x" << replay.getMapSize().y << "): reached wave "
+			<< simulation.getWave() << " in " << simulation.getTick() << " ticks" << std::endl;
+		std::cout << "Simulated " << simulation.getTick() << " ticks in " << seconds << "s: "
+			<< static_cast<long long>(simulation.getTick() / seconds) << " ticks/s" << std::endl;
+
+		if (!replay.isFinished())
+			std::cerr << "Warning: The game ended before the replay did; it may have been recorded with different rules!" << std::endl;
+		return 0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int games = 1;
+	int maxWaves = 100;
+	std::uint64_t seed = Rng::makeRandomSeed();
+	std::string recordFilename;
+	std::string replayFilename;
+	int threadCount = WorkerPool::getDefaultThreadCount();
+	sf::Vector2i mapSize(10, 8);
+	Grid::PathingMode pathingMode = Grid::PathingMode::Lane;
+	std::shared_ptr<const Balance> balance = std::make_shared<const Balance>();
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--games" && i + 1 < argc)
+			games = std::stoi(argv[++i]);
+		else if (arg == "--max-waves" && i + 1 < argc)
+			maxWaves = std::stoi(argv[++i]);
+		else if (arg == "--seed" && i + 1 < argc)
+			seed = std::stoull(argv[++i]);
+		else if (arg == "--record" && i + 1 < argc)
+			recordFilename = argv[++i];
+		else if (arg == "--replay" && i + 1 < argc)
+			replayFilename = argv[++i];
+		else if (arg == "--threads" && i + 1 < argc)
+			threadCount = std::stoi(argv[++i]);
+		else if (arg == "--map-size" && i + 1 < argc && Utility::parseMapSize(argv[i + 1]))
+			mapSize = *Utility::parseMapSize(argv[++i]);
+		else if (arg == "--maze")
+			pathingMode = Grid::PathingMode::Maze;
+		else if (arg == "--balance" && i + 1 < argc)
+		{
+			auto loaded = std::make_shared<Balance>();
+			if (!loaded->loadFromFile(argv[++i]))
+				return 1;
+			balance = loaded;
+		}
+		else
+		{
+			std::cerr << USAGE << std::endl;
+			return 1;
+		}
+	}
+
+	if (!replayFilename.empty())
+		return runReplay(replayFilename, maxWaves, threadCount, balance);
+
+	Simulation simulation(mapSize.x, mapSize.y, seed);
+	simulation.setWorkerThreadCount(threadCount);
+	simulation.setBalance(balance);
+	simulation.setPathingMode(pathingMode);
+	Replay recording(seed, mapSize, pathingMode);
+	ScriptedPolicy policy;
+
+	unsigned long long totalTicks = 0;
+	int totalWaves = 0;
+	auto startTime = std::chrono::steady_clock::now();
+
+	for (int game = 0; game < games; ++game)
+	{
+		simulation.reset(seed + game);
+		simulation.setRecorder(game == 0 && !recordFilename.empty() ? &recording : nullptr);
+
+		while (!simulation.isGameOver() && simulation.getWave() <= maxWaves)
+		{
+			policy.submitCommands(simulation);
+			simulation.update(Simulation::FIXED_TIME_STEP);
+			simulation.updateEffects(Simulation::FIXED_TIME_STEP);
+		}
+
+		std::cout << "Game " << game + 1 << " (seed " << simulation.getSeed() << "): reached wave " << simulation.getWave()
+			<< " in " << simulation.getTick() << " ticks" << std::endl;
+
+		if (game == 0 && !recordFilename.empty() && recording.saveToFile(recordFilename))
+			std::cout << "Recorded " << recording.getCommandCount() << " commands to " << recordFilename << std::endl;
+
+		totalTicks += simulation.getTick();
+		totalWaves += simulation.getWave();
+	}
+
+	float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+	std::cout << "Simulated " << totalWaves << " waves (" << totalTicks << " ticks) in " << seconds << "s: "
+		<< static_cast<int>(totalWaves / seconds) << " waves/s, "
+		<< static_cast<long long>(totalTicks / seconds) << " ticks/s" << std::endl;
+
+	return 0;
+}
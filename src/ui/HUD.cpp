@@ -13,6 +13,8 @@ HUD::HUD(const sf::Font& font, sf::Vector2u windowSize) :
 	lives(0),
 	gold(0),
 	wave(0),
+	m_isProfilerOverlayVisible(false),
+	profilerText(font, "", 18U),
 	livesText(font, "Level: N/A", 48U),
 	goldText(font, "Gold: N/A", 48U),
 	waveText(font, "Wave: N/A", 48U),
@@ -40,6 +42,11 @@ HUD::HUD(const sf::Font& font, sf::Vector2u windowSize) :
 	//infoText.setOutlineThickness(2.f);
 	//infoText.setOutlineColor(sf::Color(50, 53, 55));
 	infoText.setPosition(sf::Vector2f(windowSize.x - infoText.getGlobalBounds().size.x - 40.f, windowSize.y - infoText.getGlobalBounds().size.y * 1.6f));
+
+	profilerText.setFillColor(sf::Color(220, 223, 225));
+	profilerText.setPosition(sf::Vector2f(20.f, 20.f));
+	profilerBackground.setFillColor(sf::Color(0, 0, 0, 160));
+	profilerBackground.setPosition(sf::Vector2f(10.f, 10.f));
 }
 
 void HUD::update(float fixedTimeStep, int lives, int gold, int wave)
@@ -67,4 +74,16 @@ void HUD::render(float interpolationFactor, sf::RenderWindow& window)
 	window.draw(goldText);
 	window.draw(waveText);
 	window.draw(infoText);
+
+	if (m_isProfilerOverlayVisible)
+	{
+		window.draw(profilerBackground);
+		window.draw(profilerText);
+	}
+}
+
+void HUD::updateProfilerOverlay(const Profiler& profiler)
+{
+	profilerText.setString(profiler.getSummary());
+	profilerBackground.setSize(profilerText.getGlobalBounds().size + sf::Vector2f(20.f, 20.f));
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "../core/Profiler.hpp"
 
 class HUD
 {
@@ -20,9 +21,17 @@ public:
 	void update(float fixedTimeStep, int lives, int gold, int wave);
 	void render(float interpolationFactor, sf::RenderWindow& window);
 
+	inline void setProfilerOverlayVisible(bool isVisible) { m_isProfilerOverlayVisible = isVisible; }
+	inline bool isProfilerOverlayVisible() const { return m_isProfilerOverlayVisible; }
+	void updateProfilerOverlay(const Profiler& profiler);
+
 private:
 	int lives, gold, wave;
 
+	bool m_isProfilerOverlayVisible;
+	sf::RectangleShape profilerBackground;
+	sf::Text profilerText;
+
 	sf::Text livesText;
 	sf::Text goldText;
 	sf::Text waveText;
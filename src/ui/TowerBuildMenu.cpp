@@ -25,25 +25,34 @@ TowerBuildMenu::TowerBuildMenu(const sf::Font& font, const std::string& title, s
 	selectedTile({ -1, -1 }),
 	requestedTowerType(TowerRegistry::Type::Count)
 {
-	const auto& towerRegistry = TowerRegistry::getTowerMetadataRegistry();
-
-	for (const auto& metadata : towerRegistry)
+	for (const auto& metadata : TowerRegistry::getTowerMetadataRegistry())
 	{
 		Option option(font);
 		option.type = metadata.type;
-		option.buyCost = metadata.attributes[0].buyCost;
 		option.name.setString(metadata.name);
 		option.name.setOutlineThickness(UIManager::TEXT_OUTLINE_THICKNESS);
 		option.name.setOutlineColor(UIManager::TEXT_OUTLINE_COLOR);
-		switch (metadata.type)
+		option.button = Button(font, "N/A", sf::Vector2f(150.f, 50.f));
+		options.push_back(option);
+	}
+	setBalance(Balance());
+}
+
+void TowerBuildMenu::setBalance(const Balance& balance)
+{
+	for (auto& option : options)
+	{
+		const TowerRegistry::AttributesPerLevel& attributes = balance.getTowerAttributes(option.type).at(0);
+		option.buyCost = attributes.buyCost;
+		switch (option.type)
 		{
 		case TowerRegistry::Type::Bullet:
 		{
 			option.description.setString
 			(
-				"Damage: " + std::to_string(metadata.attributes[0].damage) +
-				"\nRange: " + std::to_string(static_cast<int>(metadata.attributes[0].range)) +
-				"\nFire Rate: " + Utility::removeTrailingZeros(metadata.attributes[0].fireRate)
+				"Damage: " + std::to_string(attributes.damage) +
+				"\nRange: " + std::to_string(static_cast<int>(attributes.range)) +
+				"\nFire Rate: " + Utility::removeTrailingZeros(attributes.fireRate)
 			);
 			break;
 		}
@@ -51,10 +60,10 @@ TowerBuildMenu::TowerBuildMenu(const sf::Font& font, const std::string& title, s
 		{
 			option.description.setString
 			(
-				"Damage: " + std::to_string(metadata.attributes[0].damage) +
-				"\nRange: " + std::to_string(static_cast<int>(metadata.attributes[0].range)) +
-				"\nFire Rate: " + Utility::removeTrailingZeros(metadata.attributes[0].fireRate) +
-				"\nRadius: " + Utility::removeTrailingZeros(metadata.attributes[0].splashRadius)
+				"Damage: " + std::to_string(attributes.damage) +
+				"\nRange: " + std::to_string(static_cast<int>(attributes.range)) +
+				"\nFire Rate: " + Utility::removeTrailingZeros(attributes.fireRate) +
+				"\nRadius: " + Utility::removeTrailingZeros(attributes.splashRadius)
 			);
 			break;
 		}
@@ -62,17 +71,16 @@ TowerBuildMenu::TowerBuildMenu(const sf::Font& font, const std::string& title, s
 		{
 			option.description.setString
 			(
-				"Damage: " + std::to_string(metadata.attributes[0].damage) +
-				"\nRange: " + std::to_string(static_cast<int>(metadata.attributes[0].range)) +
-				"\nPulse Rate: " + Utility::removeTrailingZeros(metadata.attributes[0].fireRate) +
-				"\nPercent: " + std::to_string(static_cast<int>(metadata.attributes[0].slowAmount * 100.f)) + "%" +
-				"\nDuration: " + Utility::removeTrailingZeros(metadata.attributes[0].slowDuration) + "s"
+				"Damage: " + std::to_string(attributes.damage) +
+				"\nRange: " + std::to_string(static_cast<int>(attributes.range)) +
+				"\nPulse Rate: " + Utility::removeTrailingZeros(attributes.fireRate) +
+				"\nPercent: " + std::to_string(static_cast<int>(attributes.slowAmount * 100.f)) + "%" +
+				"\nDuration: " + Utility::removeTrailingZeros(attributes.slowDuration) + "s"
 			);
 			break;
 		}
 		}
-		option.button = Button(font, std::to_string(metadata.attributes[0].buyCost) + std::string("g"), sf::Vector2f(150.f, 50.f));
-		options.push_back(option);
+		option.button.setText(std::to_string(attributes.buyCost) + std::string("g"));
 	}
 }
 
@@ -118,12 +126,12 @@ void TowerBuildMenu::render(float interpolationFactor, sf::RenderWindow& window)
 	}
 }
 
-void TowerBuildMenu::setSelectedTile(sf::Vector2i tilePosition, sf::Vector2u windowSize)
+void TowerBuildMenu::setSelectedTile(sf::Vector2i tilePosition, sf::Vector2f tileScreenPosition, sf::Vector2u windowSize)
 {
 	selectedTile = tilePosition;
 	m_isActive = true;
 
-	updateLayout(windowSize);
+	updateLayout(tileScreenPosition, windowSize);
 
 	for (auto& option : options)
 	{
@@ -141,9 +149,9 @@ void TowerBuildMenu::clearTileSelection()
 	m_isActive = false;
 }
 
-void TowerBuildMenu::updateLayout(sf::Vector2u windowSize)
+void TowerBuildMenu::updateLayout(sf::Vector2f tileScreenPosition, sf::Vector2u windowSize)
 {
-	position = Utility::tileToPixelPosition(selectedTile.x, selectedTile.y);
+	position = tileScreenPosition;
 
 	// Offset the position to center the menu below the tower
 	sf::Vector2f offset = { -background.getSize().x / 2.f, 70.f };
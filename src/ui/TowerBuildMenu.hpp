@@ -12,6 +12,7 @@
 #pragma once
 
 #include "Menu.hpp"
+#include "../core/Balance.hpp"
 #include "../entities/Tower.hpp"
 
 class TowerBuildMenu : public Menu
@@ -23,8 +24,12 @@ public:
 	void update(float fixedTimeStep);
 	void render(float interpolationFactor, sf::RenderWindow& window);
 
+	// Updates the stats and costs shown for each tower. The menu starts with the built-in balance.
+	void setBalance(const Balance& balance);
+
 	inline TowerRegistry::Type getRequestedTowerType() const { return requestedTowerType; }
-	void setSelectedTile(sf::Vector2i tilePosition, sf::Vector2u windowSize);
+	// The menu is placed below the tile's center, given in screen coordinates
+	void setSelectedTile(sf::Vector2i tilePosition, sf::Vector2f tileScreenPosition, sf::Vector2u windowSize);
 	void clearTileSelection();
 
 	sf::Vector2i getSelectedTile() const { return selectedTile; }
@@ -32,7 +37,7 @@ public:
 	inline bool isHovered() const { return m_isHovered; }
 
 private:
-	void updateLayout(sf::Vector2u windowSize);
+	void updateLayout(sf::Vector2f tileScreenPosition, sf::Vector2u windowSize);
 
 	const std::shared_ptr<int>& gold;
 
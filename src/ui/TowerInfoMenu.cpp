@@ -7,6 +7,8 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <sstream>
 #include "TowerInfoMenu.hpp"
@@ -16,7 +18,12 @@ TowerInfoMenu::TowerInfoMenu(const sf::Font& font, const std::string& title, sf:
 	gold(gold),
 	wasUpgradeButtonHoveredLastFrame(false),
 	needsTextUpdate(false),
+	requestedAction(Action::None),
+	requestedActionTile({ -1, -1 }),
+	requestedTargetingPolicy(TargetIndex::Policy::Closest),
+	displayedTargetingPolicy(TargetIndex::Policy::Closest),
 	infoText(font, "N/A", 24U),
+	targetingButton(font, "TARGET: N/A", { 260.f, 40.f }),
 	upgradeButton(font, "UPGRADE\n(N/Ag)", { 130.f, 60.f }),
 	sellButton(font, "SELL\n(N/Ag)", { 90.f, 60.f })
 {
@@ -42,17 +49,30 @@ void TowerInfoMenu::processInput(sf::Vector2f mousePosition, bool isMouseRelease
 
 	upgradeButton.processInput(mousePosition, isMouseReleased);
 	sellButton.processInput(mousePosition, isMouseReleased);
+	if (hasTargeting())
+		targetingButton.processInput(mousePosition, isMouseReleased);
+
+	// Each click moves the tower on to the next policy
+	if (hasTargeting() && targetingButton.isClicked())
+	{
+		requestedAction = Action::CycleTargeting;
+		requestedActionTile = selectedTower->getTilePosition();
+		requestedTargetingPolicy = static_cast<TargetIndex::Policy>(
+			(static_cast<int>(selectedTower->getTargetingPolicy()) + 1) % static_cast<int>(TargetIndex::Policy::Count));
+	}
 
 	// Check if the upgrade button is clicked and the tower is not at max level
 	if (upgradeButton.isClicked() && selectedTower && selectedTower->getLevel() < selectedTower->getMaxLevel())
 	{
-		selectedTower->markForUpgrade();
+		requestedAction = Action::Upgrade;
+		requestedActionTile = selectedTower->getTilePosition();
 		needsTextUpdate = true;
 	}
 	// Check if the sell button is clicked
 	if (sellButton.isClicked() && selectedTower)
 	{
-		selectedTower->markForSale();
+		requestedAction = Action::Sell;
+		requestedActionTile = selectedTower->getTilePosition();
 		clearTowerSelection();
 	}
 }
@@ -76,8 +96,13 @@ void TowerInfoMenu::update(float fixedTimeStep)
 		upgradeButton.setIsActive(false);
 	}
 	
+	if (hasTargeting() && selectedTower->getTargetingPolicy() != displayedTargetingPolicy)
+		updateTargetingButtonText();
+
 	upgradeButton.update(fixedTimeStep);
 	sellButton.update(fixedTimeStep);	
+	if (hasTargeting())
+		targetingButton.update(fixedTimeStep);
 }
 
 void TowerInfoMenu::render(float interpolationFactor, sf::RenderWindow& window)
@@ -89,9 +114,11 @@ void TowerInfoMenu::render(float interpolationFactor, sf::RenderWindow& window)
 	window.draw(infoText);
 	upgradeButton.render(interpolationFactor, window);
 	sellButton.render(interpolationFactor, window);
+	if (hasTargeting())
+		targetingButton.render(interpolationFactor, window);
 }
 
-void TowerInfoMenu::setSelectedTower(std::shared_ptr<Tower> tower, sf::Vector2u windowSize)
+void TowerInfoMenu::setSelectedTower(std::shared_ptr<Tower> tower, sf::Vector2f towerScreenPosition, sf::Vector2u windowSize)
 {
 	m_isActive = true;
 	selectedTower = tower;
@@ -105,7 +132,8 @@ void TowerInfoMenu::setSelectedTower(std::shared_ptr<Tower> tower, sf::Vector2u
 
 	titleText.setString(selectedTower->getName());
 	updateInfoText();	
-	updateLayout(windowSize);
+	updateTargetingButtonText();
+	updateLayout(towerScreenPosition, windowSize);
 }
 
 void TowerInfoMenu::clearTowerSelection()
@@ -188,11 +216,22 @@ void TowerInfoMenu::updateInfoText()
 	infoText.setString(ss.str());
 }
 
-void TowerInfoMenu::updateLayout(sf::Vector2u windowSize)
+void TowerInfoMenu::updateTargetingButtonText()
+{
+	if (!selectedTower) return;
+
+	displayedTargetingPolicy = selectedTower->getTargetingPolicy();
+	std::string policyName = TargetIndex::getPolicyName(displayedTargetingPolicy);
+	std::transform(policyName.begin(), policyName.end(), policyName.begin(),
+		[](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+	targetingButton.setText("TARGET: " + policyName);
+}
+
+void TowerInfoMenu::updateLayout(sf::Vector2f towerScreenPosition, sf::Vector2u windowSize)
 {
 	if (!selectedTower) return;
 
-	position = Utility::tileToPixelPosition(selectedTower->getTilePosition().x, selectedTower->getTilePosition().y);
+	position = towerScreenPosition;
 
 	// Offset the position to center the menu below the tower
 	sf::Vector2f offset = { -background.getSize().x / 2.f, 70.f };
@@ -237,4 +276,9 @@ void TowerInfoMenu::updateLayout(sf::Vector2u windowSize)
 			background.getPosition().x + background.getSize().x - sellButton.getSize().x - padding.x,
 			background.getPosition().y + background.getSize().y - sellButton.getSize().y - padding.y
 		});
+	targetingButton.setPosition(
+		{
+			background.getPosition().x + padding.x,
+			background.getPosition().y + background.getSize().y - upgradeButton.getSize().y - targetingButton.getSize().y - padding.y * 1.5f
+		});
 }
\ No newline at end of file
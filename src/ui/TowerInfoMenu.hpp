@@ -4,7 +4,7 @@
 // Created: May 1, 2025
 // Description: Defines the TowerInfoMenu class, which is responsible for rendering the tower information panel.
 //              This class displays the attributes of the selected tower, including its level, damage, and sell cost,
-//              as well as the option to upgrade the tower.
+//              as well as the option to upgrade the tower and to change which enemy it targets.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -18,22 +18,40 @@
 class TowerInfoMenu : public Menu
 {
 public:
+	enum class Action
+	{
+		None,
+		Upgrade,
+		Sell,
+		CycleTargeting
+	};
+
 	TowerInfoMenu(const sf::Font& font, const std::string& title, sf::Vector2f size, const std::shared_ptr<int>& gold);
 
 	void processInput(sf::Vector2f mousePosition, bool isMouseReleased) override;
 	void update(float fixedTimeStep) override;
 	void render(float interpolationFactor, sf::RenderWindow& window) override;
 
-	void setSelectedTower(std::shared_ptr<Tower> tower, sf::Vector2u windowSize);
+	// The menu is placed below the tower's center, given in screen coordinates
+	void setSelectedTower(std::shared_ptr<Tower> tower, sf::Vector2f towerScreenPosition, sf::Vector2u windowSize);
 	void clearTowerSelection();
 
 	inline bool isTowerSelected() const { return selectedTower != nullptr; }
+	// The action the player clicked, to be applied by the game to the tower on the requested tile
+	inline Action getRequestedAction() const { return requestedAction; }
+	inline sf::Vector2i getRequestedActionTile() const { return requestedActionTile; }
+	// The policy a CycleTargeting action switches the tower to
+	inline TargetIndex::Policy getRequestedTargetingPolicy() const { return requestedTargetingPolicy; }
+	inline void clearRequestedAction() { requestedAction = Action::None; }
 	inline bool isActive() const { return m_isActive; }
 	inline bool isHovered() const { return m_isHovered; }
 
 private:
 	void updateInfoText();
-	void updateLayout(sf::Vector2u windowSize);
+	void updateTargetingButtonText();
+	// Slow towers affect every enemy in range, so they have no target to choose
+	inline bool hasTargeting() const { return selectedTower && selectedTower->getType() != TowerRegistry::Type::Slow; }
+	void updateLayout(sf::Vector2f towerScreenPosition, sf::Vector2u windowSize);
 
 	const std::shared_ptr<int>& gold;
 
@@ -41,7 +59,14 @@ private:
 	bool needsTextUpdate;
 
 	std::shared_ptr<Tower> selectedTower;
+	Action requestedAction;
+	sf::Vector2i requestedActionTile;
+	TargetIndex::Policy requestedTargetingPolicy;
+	// The policy shown on the targeting button; the tower only takes on a requested policy once
+	// the game has applied the command
+	TargetIndex::Policy displayedTargetingPolicy;
 	sf::Text infoText;
+	Button targetingButton;
 	Button upgradeButton;
 	Button sellButton;
 };
\ No newline at end of file
@@ -24,7 +24,7 @@ const float UIManager::BACKGROUND_OUTLINE_THICKNESS = 3.f;
 
 UIManager::UIManager(const sf::Font& font, sf::Vector2u windowSize, const std::shared_ptr<int>& gold) :
 	hud(font, { 1200, 1200 }),
-	towerInfoMenu(font, "Tower Info", { 300.f, 300.f }, gold),
+	towerInfoMenu(font, "Tower Info", { 300.f, 360.f }, gold),
 	towerBuildMenu(font, "Choose a Tower to Build", { 620.f, 300.f }, gold)
 {}
 
@@ -54,18 +54,18 @@ void UIManager::render(float interpolationFactor, sf::RenderWindow& window)
 		towerBuildMenu.render(interpolationFactor, window);
 }
 
-void UIManager::showTowerInfoMenu(std::shared_ptr<Tower> tower, sf::Vector2u windowSize)
+void UIManager::showTowerInfoMenu(std::shared_ptr<Tower> tower, sf::Vector2f screenPosition, sf::Vector2u windowSize)
 {
 	if (tower)
-		towerInfoMenu.setSelectedTower(tower, windowSize);
+		towerInfoMenu.setSelectedTower(tower, screenPosition, windowSize);
 	else
 		towerInfoMenu.clearTowerSelection();
 }
 
-void UIManager::showTowerBuildMenu(sf::Vector2i selectedTile, sf::Vector2u windowSize)
+void UIManager::showTowerBuildMenu(sf::Vector2i selectedTile, sf::Vector2f screenPosition, sf::Vector2u windowSize)
 {
 	towerBuildMenu.clearTileSelection();
-	towerBuildMenu.setSelectedTile(selectedTile, windowSize);
+	towerBuildMenu.setSelectedTile(selectedTile, screenPosition, windowSize);
 }
 
 void UIManager::dismissAllMenus()
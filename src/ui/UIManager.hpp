@@ -23,14 +23,25 @@ public:
 	void update(float fixedTimeStep, int lives, int gold, int wave);
 	void render(float interpolationFactor, sf::RenderWindow& window);
 
-	void showTowerInfoMenu(std::shared_ptr<Tower> tower, sf::Vector2u windowSize);
-	void showTowerBuildMenu(sf::Vector2i selectedTile, sf::Vector2u windowSize);
+	// Menus are placed next to the given screen position of the tower or tile
+	void showTowerInfoMenu(std::shared_ptr<Tower> tower, sf::Vector2f screenPosition, sf::Vector2u windowSize);
+	void showTowerBuildMenu(sf::Vector2i selectedTile, sf::Vector2f screenPosition, sf::Vector2u windowSize);
 	void dismissAllMenus();
 
+	inline void setBalance(const Balance& balance) { towerBuildMenu.setBalance(balance); }
+
 	inline sf::Vector2i getSelectedTile() const { return towerBuildMenu.getSelectedTile(); }
 	inline TowerRegistry::Type getRequestedTowerType() const { return towerBuildMenu.getRequestedTowerType(); }
+	inline TowerInfoMenu::Action getRequestedTowerAction() const { return towerInfoMenu.getRequestedAction(); }
+	inline sf::Vector2i getRequestedTowerActionTile() const { return towerInfoMenu.getRequestedActionTile(); }
+	inline TargetIndex::Policy getRequestedTargetingPolicy() const { return towerInfoMenu.getRequestedTargetingPolicy(); }
+	inline void clearRequestedTowerAction() { towerInfoMenu.clearRequestedAction(); }
 	bool isAnyMenuHoveredOver() const;
 
+	inline void setProfilerOverlayVisible(bool isVisible) { hud.setProfilerOverlayVisible(isVisible); }
+	inline bool isProfilerOverlayVisible() const { return hud.isProfilerOverlayVisible(); }
+	inline void updateProfilerOverlay(const Profiler& profiler) { hud.updateProfilerOverlay(profiler); }
+
 	static const sf::Color TEXT_COLOR;
 	static const sf::Color TEXT_HOVER_COLOR;
 	static const sf::Color TEXT_OUTLINE_COLOR;